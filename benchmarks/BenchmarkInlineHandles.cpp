@@ -0,0 +1,179 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <codi.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#ifdef OPDI_USE_OMPT_BACKEND
+  #include <opdi/backend/ompt/omptBackend.hpp>
+#else
+  #include <opdi/backend/macro/macroBackend.hpp>
+#endif
+#include <opdi.hpp>
+
+/* Measures the cost of pushing small AD events as inline handles for a tool that does not store them by value, i.e.,
+ * uses the default implementation of pushInlineExternalFunction.
+ *
+ * The default implementation wraps each inline handle into a regular handle with a single allocation. For comparison,
+ * the benchmark also pushes the inline handles with two allocations, one for the handle and one for the data.
+ *
+ * Recording and deletion during the tape reset are measured separately. Each thread pushes to its own tape.
+ *
+ * Usage: BenchmarkInlineHandles [events per thread] [repetitions]
+ */
+
+using Real = codi::RealReverseIndexOpenMP;
+using Tape = typename Real::Tape;
+
+struct EventData {
+  public:
+    std::size_t index;
+    std::size_t counter;
+};
+
+void reverseFunc(void*) {}
+
+void reverseFuncTwoAllocations(void* inlineHandlePtr) {
+  opdi::InlineHandle* inlineHandle = static_cast<opdi::InlineHandle*>(inlineHandlePtr);
+  inlineHandle->reverseFunc(static_cast<void*>(inlineHandle->data));
+}
+
+void deleteFuncTwoAllocations(void* inlineHandlePtr) {
+  delete static_cast<opdi::InlineHandle*>(inlineHandlePtr);
+}
+
+void pushSingleAllocation(void* tape, opdi::InlineHandle const& inlineHandle) {
+  opdi::tool->pushInlineExternalFunction(tape, inlineHandle);
+}
+
+void pushTwoAllocations(void* tape, opdi::InlineHandle const& inlineHandle) {
+  opdi::Handle* handle = new opdi::Handle;
+  handle->data = static_cast<void*>(new opdi::InlineHandle(inlineHandle));
+  handle->reverseFunc = reverseFuncTwoAllocations;
+  handle->deleteFunc = deleteFuncTwoAllocations;
+  opdi::tool->pushExternalFunction(tape, handle);
+}
+
+template<typename Push>
+void measure(int nThreads, int nEvents, int nRepetitions, Push const& push, double& recordTime, double& resetTime) {
+  Tape& tape = Real::getTape();
+
+  for (int r = 0; r < nRepetitions; ++r) {
+    tape.setActive();
+
+    double start = omp_get_wtime();
+
+    OPDI_PARALLEL(num_threads(nThreads))
+    {
+      void* localTape = opdi::tool->getThreadLocalTape();
+
+      opdi::InlineHandle handle;
+      handle.reverseFunc = reverseFunc;
+
+      for (int i = 0; i < nEvents; ++i) {
+        handle.setData(EventData{static_cast<std::size_t>(omp_get_thread_num()), static_cast<std::size_t>(i)});
+        push(localTape, handle);
+      }
+    }
+    OPDI_END_PARALLEL
+
+    double time = omp_get_wtime() - start;
+
+    tape.setPassive();
+
+    start = omp_get_wtime();
+
+    tape.reset();
+    opdi::logic->reset();
+
+    double time2 = omp_get_wtime() - start;
+
+    if (r == 0 || time < recordTime) {
+      recordTime = time;
+    }
+    if (r == 0 || time2 < resetTime) {
+      resetTime = time2;
+    }
+  }
+}
+
+void printResult(std::string const& name, int nThreads, int nEvents, double recordTime, double resetTime) {
+  std::cout << std::setw(18) << name
+            << std::setw(10) << nThreads
+            << std::setw(16) << 1.0e9 * recordTime / nEvents
+            << std::setw(16) << 1.0e9 * resetTime / nEvents << std::endl;
+}
+
+int main(int nargs, char** args) {
+
+  int nEvents = (nargs > 1) ? std::atoi(args[1]) : 100000;
+  int nRepetitions = (nargs > 2) ? std::atoi(args[2]) : 5;
+
+  // initialize OpDiLib
+
+  #ifdef OPDI_USE_MACRO_BACKEND
+    opdi::backend = new opdi::MacroBackend();
+    opdi::backend->init();
+  #endif
+  opdi::logic = new opdi::OmpLogic;
+  opdi::logic->init();
+  opdi::tool = new CoDiOpDiLibTool<Real>;
+  opdi::tool->init();
+
+  std::cout << std::setw(18) << "allocations"
+            << std::setw(10) << "threads"
+            << std::setw(16) << "record [ns/ev]"
+            << std::setw(16) << "reset [ns/ev]" << std::endl;
+
+  for (int nThreads : {1, omp_get_max_threads()}) {
+
+    double recordTime = 0.0;
+    double resetTime = 0.0;
+
+    measure(nThreads, nEvents, nRepetitions, pushSingleAllocation, recordTime, resetTime);
+    printResult("single", nThreads, nEvents, recordTime, resetTime);
+
+    measure(nThreads, nEvents, nRepetitions, pushTwoAllocations, recordTime, resetTime);
+    printResult("two", nThreads, nEvents, recordTime, resetTime);
+  }
+
+  // finalize OpDiLib
+
+  opdi::tool->finalize();
+  opdi::logic->finalize();
+  opdi::backend->finalize();
+  delete opdi::tool;
+  delete opdi::logic;
+  #ifdef OPDI_USE_MACRO_BACKEND
+    delete opdi::backend;
+  #endif
+
+  return 0;
+}
+
+// don't forget to include the OpDiLib source file
+#include "opdi.cpp"
@@ -0,0 +1,166 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <codi.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#ifdef OPDI_USE_OMPT_BACKEND
+  #include <opdi/backend/ompt/omptBackend.hpp>
+#else
+  #include <opdi/backend/macro/macroBackend.hpp>
+#endif
+#include <opdi.hpp>
+
+/* Measures the throughput of OpDiLib's recording of mutex events for increasing numbers of threads.
+ *
+ * Each thread repeatedly acquires and releases
+ *  - the unnamed critical section, which is shared among all threads (contended case), and
+ *  - a lock of its own (uncontended case, any serialization is due to the recording).
+ *
+ * Usage: BenchmarkMutexRecording [events per thread] [repetitions]
+ */
+
+using Real = codi::RealReverseIndexOpenMP;
+using Tape = typename Real::Tape;
+
+template<typename Body>
+double measure(int nThreads, int nRepetitions, Body const& body) {
+  Tape& tape = Real::getTape();
+  double bestTime = 0.0;
+
+  for (int r = 0; r < nRepetitions; ++r) {
+    tape.setActive();
+
+    double start = omp_get_wtime();
+
+    OPDI_PARALLEL(num_threads(nThreads))
+    {
+      body();
+    }
+    OPDI_END_PARALLEL
+
+    double time = omp_get_wtime() - start;
+
+    tape.setPassive();
+    tape.reset();
+    opdi::logic->reset();
+
+    if (r == 0 || time < bestTime) {
+      bestTime = time;
+    }
+  }
+
+  return bestTime;
+}
+
+void printResult(std::string const& name, int nThreads, int nEvents, double time) {
+  double nTotalEvents = 2.0 * nThreads * nEvents;  // acquire and release
+  std::cout << std::setw(14) << name
+            << std::setw(10) << nThreads
+            << std::setw(14) << time
+            << std::setw(16) << nTotalEvents / time << std::endl;
+}
+
+int main(int nargs, char** args) {
+
+  int nEvents = (nargs > 1) ? std::atoi(args[1]) : 100000;
+  int nRepetitions = (nargs > 2) ? std::atoi(args[2]) : 5;
+
+  // initialize OpDiLib
+
+  #ifdef OPDI_USE_MACRO_BACKEND
+    opdi::backend = new opdi::MacroBackend();
+    opdi::backend->init();
+  #endif
+  opdi::logic = new opdi::OmpLogic;
+  opdi::logic->init();
+  opdi::tool = new CoDiOpDiLibTool<Real>;
+  opdi::tool->init();
+
+  int maxThreads = omp_get_max_threads();
+
+  std::vector<omp_lock_t> locks(maxThreads);
+  for (auto& lock : locks) {
+    opdi::opdi_init_lock(&lock);
+  }
+
+  std::cout << std::setw(14) << "mutex"
+            << std::setw(10) << "threads"
+            << std::setw(14) << "time [s]"
+            << std::setw(16) << "events/s" << std::endl;
+
+  std::vector<int> threadCounts;
+  for (int nThreads = 1; nThreads < maxThreads; nThreads *= 2) {
+    threadCounts.push_back(nThreads);
+  }
+  threadCounts.push_back(maxThreads);
+
+  for (int nThreads : threadCounts) {
+
+    double time = measure(nThreads, nRepetitions, [&]() {
+      for (int i = 0; i < nEvents; ++i) {
+        OPDI_CRITICAL()
+        {
+        }
+        OPDI_END_CRITICAL
+      }
+    });
+
+    printResult("critical", nThreads, nEvents, time);
+
+    time = measure(nThreads, nRepetitions, [&]() {
+      omp_lock_t* lock = &locks[omp_get_thread_num()];
+      for (int i = 0; i < nEvents; ++i) {
+        opdi::opdi_set_lock(lock);
+        opdi::opdi_unset_lock(lock);
+      }
+    });
+
+    printResult("lock", nThreads, nEvents, time);
+  }
+
+  for (auto& lock : locks) {
+    opdi::opdi_destroy_lock(&lock);
+  }
+
+  // finalize OpDiLib
+
+  opdi::tool->finalize();
+  opdi::logic->finalize();
+  opdi::backend->finalize();
+  delete opdi::tool;
+  delete opdi::logic;
+  #ifdef OPDI_USE_MACRO_BACKEND
+    delete opdi::backend;
+  #endif
+
+  return 0;
+}
+
+// don't forget to include the OpDiLib source file
+#include "opdi.cpp"
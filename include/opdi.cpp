@@ -30,9 +30,35 @@
 opdi::ToolInterface* opdi::tool = nullptr;
 opdi::LogicInterface* opdi::logic = nullptr;
 opdi::BackendInterface* opdi::backend = nullptr;
+#if OPDI_STATIC_LOGIC
+  opdi::BoundLogic* opdi::BoundLogic::instance = nullptr;
+#endif
 
 omp_lock_t opdi::Output::lock;
 bool opdi::TapedOutput::active = OPDI_OMP_LOGIC_INSTRUMENT;
+opdi::BlockPool::Cache* opdi::BlockPool::localCache = nullptr;
+std::atomic<opdi::BlockPool::Cache*> opdi::BlockPool::caches(nullptr);
+std::atomic<opdi::BlockPool::Chunk*> opdi::BlockPool::chunks(nullptr);
+void* opdi::TapePool::cachedEncounteringTaskTape = nullptr;
+opdi::TapePool::Tapes* opdi::TapePool::cachedTapes = nullptr;
+std::size_t opdi::TapePool::localCacheGeneration = 0;
+std::size_t opdi::TapePool::cacheGeneration = 0;
+opdi::ReverseBarrier::Member opdi::ReverseBarrier::member = {nullptr, 0};
+std::vector<std::thread> opdi::ReverseTeam::workers;
+opdi::ReverseTeam::Job opdi::ReverseTeam::job = nullptr;
+void* opdi::ReverseTeam::jobData = nullptr;
+int opdi::ReverseTeam::jobSize = 0;
+bool opdi::ReverseTeam::stopping = false;
+std::atomic<std::size_t> opdi::ReverseTeam::generation(0);
+std::atomic<int> opdi::ReverseTeam::nFinished(0);
+std::atomic<int> opdi::ReverseTeam::nArrived(0);
+std::atomic<std::size_t> opdi::ReverseTeam::barrierGeneration(0);
+bool opdi::ReverseTeam::isOwner = false;
+int opdi::ReverseTeam::jobLevel = -1;
+std::array<opdi::WaitPolicy::Bucket, opdi::WaitPolicy::nBuckets> opdi::WaitPolicy::buckets;
+opdi::WaitPolicy::Yield opdi::WaitPolicy::yield = nullptr;
+opdi::ElasticTeam::Scheduler* opdi::ElasticTeam::scheduler = nullptr;
+void* opdi::AdjointBuffers::activeBuffer = nullptr;
 
 // include logic source
 
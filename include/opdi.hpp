@@ -41,10 +41,17 @@
 
 // logic
 
+#include "opdi/logic/boundLogic.hpp"
 #include "opdi/logic/omp/ompLogic.hpp"
 
 // tools
 
 #include "opdi/misc/output.hpp"
+#include "opdi/misc/adjointBuffers.hpp"
+#include "opdi/misc/blockPool.hpp"
+#include "opdi/misc/elasticTeam.hpp"
+#include "opdi/misc/reverseBarrier.hpp"
+#include "opdi/misc/reverseTeam.hpp"
 #include "opdi/misc/tapedOutput.hpp"
+#include "opdi/misc/waitPolicy.hpp"
 
@@ -27,7 +27,7 @@
 
 #include <stack>
 
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 namespace opdi {
 
@@ -46,10 +46,10 @@ namespace opdi {
 
       static void endRegionWithImplicitBarrier() {
         if (ImplicitBarrierTools::implicitBarrierStack.top()) {
-          logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplicit,
-                              LogicInterface::ScopeEndpoint::Begin);
-          logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplicit,
-                              LogicInterface::ScopeEndpoint::End);
+          boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplicit,
+                                     LogicInterface::ScopeEndpoint::Begin);
+          boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplicit,
+                                     LogicInterface::ScopeEndpoint::End);
           ImplicitBarrierTools::implicitBarrierStack.pop();
         }
       }
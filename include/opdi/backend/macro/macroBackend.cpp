@@ -23,7 +23,7 @@
  *
  */
 
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "macroBackend.hpp"
 
@@ -60,40 +60,40 @@ namespace opdi {
 
   void opdi_destroy_lock(omp_lock_t* lock) {
     omp_destroy_lock(lock);
-    opdi::logic->onMutexDestroyed(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
+    opdi::boundLogic()->onMutexDestroyed(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
   }
 
   void opdi_destroy_nest_lock(omp_nest_lock_t* lock) {
     omp_destroy_nest_lock(lock);
-    opdi::logic->onMutexDestroyed(LogicInterface::MutexKind::NestLock,
-                                  opdi::backend->getNestLockIdentifier(lock));
+    opdi::boundLogic()->onMutexDestroyed(LogicInterface::MutexKind::NestLock,
+                                         opdi::backend->getNestLockIdentifier(lock));
   }
 
   void opdi_set_lock(omp_lock_t* lock) {
     omp_set_lock(lock);
-    opdi::logic->onMutexAcquired(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
+    opdi::boundLogic()->onMutexAcquired(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
   }
 
   void opdi_set_nest_lock(omp_nest_lock_t* lock) {
     omp_set_nest_lock(lock);
     int lockCount = omp_test_nest_lock(lock); // user triggered locks plus lock caused by test
     if (lockCount == 2) {
-      opdi::logic->onMutexAcquired(LogicInterface::MutexKind::NestLock,
-                                   opdi::backend->getNestLockIdentifier(lock));
+      opdi::boundLogic()->onMutexAcquired(LogicInterface::MutexKind::NestLock,
+                                          opdi::backend->getNestLockIdentifier(lock));
     }
     omp_unset_nest_lock(lock); // revert lock caused by test
   }
 
   void opdi_unset_lock(omp_lock_t* lock) {
-    opdi::logic->onMutexReleased(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
+    opdi::boundLogic()->onMutexReleased(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
     omp_unset_lock(lock);
   }
 
   void opdi_unset_nest_lock(omp_nest_lock_t* lock) {
     int lockCount = omp_test_nest_lock(lock); // user triggered locks plus lock caused by test
     if (lockCount == 2) {
-      opdi::logic->onMutexReleased(LogicInterface::MutexKind::NestLock,
-                                   opdi::backend->getNestLockIdentifier(lock));
+      opdi::boundLogic()->onMutexReleased(LogicInterface::MutexKind::NestLock,
+                                          opdi::backend->getNestLockIdentifier(lock));
     }
     omp_unset_nest_lock(lock); // revert lock caused by test
     omp_unset_nest_lock(lock); // user triggered unlock
@@ -102,7 +102,7 @@ namespace opdi {
   int opdi_test_lock(omp_lock_t* lock) {
     int result = omp_test_lock(lock);
     if (result) {
-      opdi::logic->onMutexAcquired(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
+      opdi::boundLogic()->onMutexAcquired(LogicInterface::MutexKind::Lock, opdi::backend->getLockIdentifier(lock));
     }
     return result;
   }
@@ -110,8 +110,8 @@ namespace opdi {
   int opdi_test_nest_lock(omp_nest_lock_t* lock) {
     int lockCount = omp_test_nest_lock(lock);
     if (lockCount == 1) {
-      opdi::logic->onMutexAcquired(LogicInterface::MutexKind::NestLock,
-                                   opdi::backend->getNestLockIdentifier(lock));
+      opdi::boundLogic()->onMutexAcquired(LogicInterface::MutexKind::NestLock,
+                                          opdi::backend->getNestLockIdentifier(lock));
     }
     return lockCount;
   }
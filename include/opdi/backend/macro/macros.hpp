@@ -29,6 +29,7 @@
 
 #include "../../config.hpp"
 #include "../../helpers/macros.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "implicitBarrierTools.hpp"
 #include "mutexIdentifiers.hpp"
@@ -39,12 +40,12 @@
 
 #define OPDI_PARALLEL(...) \
   { \
-    void* opdiInternalParallelData = opdi::logic->onParallelBegin(opdi::DataTools::getImplicitTaskData(), omp_get_max_threads()); \
+    void* opdiInternalParallelData = opdi::boundLogic()->onParallelBegin(opdi::DataTools::getImplicitTaskData(), omp_get_max_threads()); \
     opdi::ImplicitTaskProbe opdiInternalImplicitTaskProbe(opdiInternalParallelData); \
     OPDI_PRAGMA(omp parallel __VA_ARGS__ firstprivate(opdiInternalImplicitTaskProbe))
 
 #define OPDI_END_PARALLEL \
-    opdi::logic->onParallelEnd(opdiInternalParallelData); \
+    opdi::boundLogic()->onParallelEnd(opdiInternalParallelData); \
   }
 
 #define OPDI_FOR(...) \
@@ -103,10 +104,10 @@
       opdi::tool->getTapePosition(opdi::tool->getThreadLocalTape(), opdiInternalTapePosition1); \
     } \
     /* broadcast-related barrier */ \
-    opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
-                              opdi::LogicInterface::ScopeEndpoint::Begin); \
-    opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
-                              opdi::LogicInterface::ScopeEndpoint::End); \
+    opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
+                                     opdi::LogicInterface::ScopeEndpoint::Begin); \
+    opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
+                                     opdi::LogicInterface::ScopeEndpoint::End); \
     void* opdiInternalTapePosition2 = nullptr; \
     if (opdi::tool != nullptr) { \
       opdiInternalTapePosition2 = opdi::tool->allocPosition(); \
@@ -131,10 +132,10 @@
       opdi::tool->getTapePosition(opdi::tool->getThreadLocalTape(), opdiInternalTapePosition1); \
     } \
     /* broadcast-related barrier */ \
-    opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
-                              opdi::LogicInterface::ScopeEndpoint::Begin); \
-    opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
-                              opdi::LogicInterface::ScopeEndpoint::End); \
+    opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
+                                     opdi::LogicInterface::ScopeEndpoint::Begin); \
+    opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
+                                     opdi::LogicInterface::ScopeEndpoint::End); \
     void* opdiInternalTapePosition2 = nullptr; \
     if (opdi::tool != nullptr) { \
       opdiInternalTapePosition2 = opdi::tool->allocPosition(); \
@@ -152,10 +153,10 @@
 #define OPDI_END_SINGLE \
         /* broadcast-related barrier */ \
         if (opdiInternalBroadcastIndicator) { \
-          opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
-                                    opdi::LogicInterface::ScopeEndpoint::Begin); \
-          opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
-                                    opdi::LogicInterface::ScopeEndpoint::End); \
+          opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
+                                           opdi::LogicInterface::ScopeEndpoint::Begin); \
+          opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierImplementation, \
+                                           opdi::LogicInterface::ScopeEndpoint::End); \
         } \
       } \
     } \
@@ -174,31 +175,33 @@
   OPDI_PRAGMA(omp critical __VA_ARGS__) \
   { \
     std::size_t constexpr opdiInternalCriticalIdentifier = 0; \
-    opdi::logic->onMutexAcquired(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier);
+    opdi::boundLogic()->onMutexAcquired(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier);
 
 #define OPDI_CRITICAL_NAME(name) \
   OPDI_PRAGMA(omp critical (name)) \
   { \
-    std::size_t const opdiInternalCriticalIdentifier = opdi::backend->getCriticalIdentifier(std::string(#name)); \
-    opdi::logic->onMutexAcquired(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier);
+    std::size_t constexpr opdiInternalCriticalIdentifier = opdi::MutexIdentifiers::getCriticalIdentifier(#name); \
+    opdi::MutexIdentifiers::checkCriticalIdentifier(opdiInternalCriticalIdentifier, #name); \
+    opdi::boundLogic()->onMutexAcquired(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier);
 
 #define OPDI_CRITICAL_NAME_ARGS(name, ...) \
   OPDI_PRAGMA(omp critical (name) __VA_ARGS__) \
   { \
-    std::size_t const opdiInternalCriticalIdentifier = opdi::backend->getCriticalIdentifier(std::string(#name)); \
-    opdi::logic->onMutexAcquired(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier);
+    std::size_t constexpr opdiInternalCriticalIdentifier = opdi::MutexIdentifiers::getCriticalIdentifier(#name); \
+    opdi::MutexIdentifiers::checkCriticalIdentifier(opdiInternalCriticalIdentifier, #name); \
+    opdi::boundLogic()->onMutexAcquired(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier);
 
 #define OPDI_END_CRITICAL \
-    opdi::logic->onMutexReleased(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier); \
+    opdi::boundLogic()->onMutexReleased(opdi::LogicInterface::MutexKind::Critical, opdiInternalCriticalIdentifier); \
   }
 
 #define OPDI_ORDERED(...) \
   OPDI_PRAGMA(omp ordered __VA_ARGS__) \
   { \
-    opdi::logic->onMutexAcquired(opdi::LogicInterface::MutexKind::Ordered, opdi::backend->getOrderedIdentifier());
+    opdi::boundLogic()->onMutexAcquired(opdi::LogicInterface::MutexKind::Ordered, opdi::backend->getOrderedIdentifier());
 
 #define OPDI_END_ORDERED \
-    opdi::logic->onMutexReleased(opdi::LogicInterface::MutexKind::Ordered, opdi::backend->getOrderedIdentifier()); \
+    opdi::boundLogic()->onMutexReleased(opdi::LogicInterface::MutexKind::Ordered, opdi::backend->getOrderedIdentifier()); \
   }
 
 #define OPDI_SECTION(...) \
@@ -210,19 +213,19 @@
   #define OPDI_MASTER(...) \
     OPDI_PRAGMA(omp master __VA_ARGS__) \
     { \
-      opdi::logic->onMasked(opdi::LogicInterface::ScopeEndpoint::Begin);
+      opdi::boundLogic()->onMasked(opdi::LogicInterface::ScopeEndpoint::Begin);
 
   #define OPDI_END_MASTER \
-      opdi::logic->onMasked(opdi::LogicInterface::ScopeEndpoint::End); \
+      opdi::boundLogic()->onMasked(opdi::LogicInterface::ScopeEndpoint::End); \
     }
 
   #define OPDI_MASKED(...) \
     OPDI_PRAGMA(omp masked __VA_ARGS__) \
     { \
-      opdi::logic->onMasked(opdi::LogicInterface::ScopeEndpoint::Begin);
+      opdi::boundLogic()->onMasked(opdi::LogicInterface::ScopeEndpoint::Begin);
 
   #define OPDI_END_MASKED \
-      opdi::logic->onMasked(opdi::LogicInterface::ScopeEndpoint::End); \
+      opdi::boundLogic()->onMasked(opdi::LogicInterface::ScopeEndpoint::End); \
     }
 #else
   #define OPDI_MASTER(...) \
@@ -236,14 +239,30 @@
   #define OPDI_END_MASKED
 #endif
 
+// constructs in between are recorded without reverse synchronization, only use for constructs that protect passive data
+
+#define OPDI_NO_REVERSE_SYNC \
+  { \
+    opdi::boundLogic()->beginSkippedReverseSynchronization();
+
+#define OPDI_END_NO_REVERSE_SYNC \
+    opdi::boundLogic()->endSkippedReverseSynchronization(); \
+  }
+
 // standalone macros
 
 #define OPDI_BARRIER(...) \
-  opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierExplicit, \
-                            opdi::LogicInterface::ScopeEndpoint::Begin); \
+  opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierExplicit, \
+                                   opdi::LogicInterface::ScopeEndpoint::Begin); \
   OPDI_PRAGMA(omp barrier __VA_ARGS__) \
-  opdi::logic->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierExplicit, \
-                            opdi::LogicInterface::ScopeEndpoint::End);
+  opdi::boundLogic()->onSyncRegion(opdi::LogicInterface::SyncRegionKind::BarrierExplicit, \
+                                   opdi::LogicInterface::ScopeEndpoint::End);
+
+// marks the begin of a chunk of iterations inside a worksharing loop
+// with loop work stealing, chunks must not accumulate into private variables that outlive them
+
+#define OPDI_LOOP_CHUNK \
+  opdi::boundLogic()->onLoopChunk();
 
 // reduction macros
 
@@ -25,28 +25,54 @@
 
 #pragma once
 
-#include <map>
+#include <cassert>
+#include <cstdint>
 #include <omp.h>
+#include <string>
+#include <unordered_map>
+
+#include "../../helpers/macros.hpp"
 
 #include "../backendInterface.hpp"
 
 namespace opdi {
 
   struct MutexIdentifiers : public virtual BackendInterface {
-    private:
+    public:
 
-      omp_lock_t criticalLock;
-      std::map<std::string, std::size_t> criticalIdentifiers;
-      std::size_t nextCriticalIdentifier;
+      // FNV-1a hash of the name, can be evaluated at compile time and does not require synchronization
+      // if the identifiers of different names collide, the logic treats the critical regions like a single one, this
+      // adds synchronization to the reverse pass but retains correctness unless the critical regions are nested
+      static constexpr std::size_t getCriticalIdentifier(char const* name) {
+        // unnamed critical region has index 0
+        if (*name == '\0') {
+          return 0;
+        }
 
-    public:
-      MutexIdentifiers() : nextCriticalIdentifier(1) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (; *name != '\0'; ++name) {
+          hash ^= static_cast<unsigned char>(*name);
+          hash *= 1099511628211ull;
+        }
 
-        omp_init_lock(&this->criticalLock);
+        std::size_t result = static_cast<std::size_t>(hash);
+        return result == 0 ? 1 : result;
       }
 
-      ~MutexIdentifiers() {
-        omp_destroy_lock(&this->criticalLock);
+      // debug builds keep track of the names per identifier and detect collisions
+      static void checkCriticalIdentifier(std::size_t identifier, char const* name) {
+        #ifdef NDEBUG
+          OPDI_UNUSED(identifier);
+          OPDI_UNUSED(name);
+        #else
+          static std::unordered_map<std::size_t, std::string> names;
+
+          #pragma omp critical (opdiCheckCriticalIdentifier)
+          {
+            auto iter = names.emplace(identifier, name).first;
+            assert(iter->second == name);  // identifiers of different names collide
+          }
+        #endif
       }
 
       std::size_t getLockIdentifier(omp_lock_t* lock) {
@@ -58,19 +84,9 @@ namespace opdi {
       }
 
       std::size_t getCriticalIdentifier(std::string const& name) {
-        // unnamed critical region has index 0
-        if (name.empty()) {
-          return 0;
-        }
-
-        omp_set_lock(&this->criticalLock);
-        if (this->criticalIdentifiers.count(name) == 0) {
-          this->criticalIdentifiers[name] = this->nextCriticalIdentifier++;
-        }
-        unsigned int result = this->criticalIdentifiers[name];
-        omp_unset_lock(&this->criticalLock);
-
-        return result;
+        std::size_t identifier = MutexIdentifiers::getCriticalIdentifier(name.c_str());
+        MutexIdentifiers::checkCriticalIdentifier(identifier, name.c_str());
+        return identifier;
       }
 
       std::size_t getReductionIdentifier() {
@@ -26,7 +26,7 @@
 #pragma once
 
 #include "../../helpers/exceptions.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 #include "../../tool/toolInterface.hpp"
 
 #include "dataTools.hpp"
@@ -49,8 +49,8 @@ namespace opdi {
       ImplicitTaskProbe(ImplicitTaskProbe const& other) : parallelData(other.parallelData), needsAction(true) {
 
         DataTools::pushParallelData(this->parallelData);
-        this->taskData = logic->onImplicitTaskBegin(false, omp_get_num_threads(), omp_get_thread_num(),
-                                                    this->parallelData);
+        this->taskData = boundLogic()->onImplicitTaskBegin(false, omp_get_num_threads(), omp_get_thread_num(),
+                                                           this->parallelData);
         DataTools::pushTaskData(this->taskData);
 
         assert(ReductionTools::implicitTaskNestingDepth <= omp_get_level());
@@ -72,7 +72,7 @@ namespace opdi {
           ReductionTools::endRegionThatSupportsReductions();
           --ReductionTools::implicitTaskNestingDepth;
 
-          logic->onImplicitTaskEnd(this->taskData);
+          boundLogic()->onImplicitTaskEnd(this->taskData);
           DataTools::popTaskData();
           DataTools::popParallelData();
         }
@@ -91,14 +91,14 @@ namespace opdi {
 
       WorkProbe() : needsAction(true) {
         #if OPDI_BACKEND_GENERATE_WORK_EVENTS
-          logic->onWork(kind, LogicInterface::ScopeEndpoint::Begin);
+          boundLogic()->onWork(kind, LogicInterface::ScopeEndpoint::Begin);
         #endif
       }
 
       ~WorkProbe() {
         #if OPDI_BACKEND_GENERATE_WORK_EVENTS
           if (needsAction) {
-            logic->onWork(kind, LogicInterface::ScopeEndpoint::End);
+            boundLogic()->onWork(kind, LogicInterface::ScopeEndpoint::End);
           }
         #endif
       }
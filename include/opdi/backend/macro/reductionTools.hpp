@@ -31,7 +31,7 @@
 #include <stack>
 #include <string>
 
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "../runtime.hpp"
 
@@ -73,13 +73,13 @@ namespace opdi {
         if (ReductionTools::hasReductions.top() && ReductionTools::needsBarrierAfterReductions.top()) {
 
           /* add barrier after reductions */
-          logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
-                              LogicInterface::ScopeEndpoint::Begin);
+          boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
+                                     LogicInterface::ScopeEndpoint::Begin);
           /* actual barrier to separate subsequent worksharing constructs with a reduction, in particular if the first
            * one uses nowait; otherwise risk of invalid order of locks and this reverse-only barrier */
           #pragma omp barrier
-          logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
-                              LogicInterface::ScopeEndpoint::End);
+          boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
+                                     LogicInterface::ScopeEndpoint::End);
 
           if (ReductionTools::needsBarrierBeforeReductions.top() == true) {
             OPDI_ERROR("barrier missing before reductions");
@@ -99,10 +99,10 @@ namespace opdi {
 
       static void addBarrierBeforeReductionsIfNeeded() {
         if (ReductionTools::needsBarrierBeforeReductions.top()) {
-          logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
-                              LogicInterface::ScopeEndpoint::Begin);
-          logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
-                              LogicInterface::ScopeEndpoint::End);
+          boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
+                                     LogicInterface::ScopeEndpoint::Begin);
+          boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation,
+                                     LogicInterface::ScopeEndpoint::End);
           ReductionTools::needsBarrierBeforeReductions.top() = false;
         }
       }
@@ -122,8 +122,8 @@ namespace opdi {
 
         /* first constructor call in the course of a statement acquires the mutex */
         if (nConstructorCalls == 0) {
-          opdi::logic->onMutexAcquired(opdi::LogicInterface::MutexKind::Reduction,
-                                       opdi::backend->getReductionIdentifier());
+          opdi::boundLogic()->onMutexAcquired(opdi::LogicInterface::MutexKind::Reduction,
+                                              opdi::backend->getReductionIdentifier());
         }
         ++nConstructorCalls;
       }
@@ -131,8 +131,8 @@ namespace opdi {
       Reducer& operator=(Type const& rhs) {
         value = rhs;
 
-        opdi::logic->onMutexReleased(opdi::LogicInterface::MutexKind::Reduction,
-                                     opdi::backend->getReductionIdentifier());
+        opdi::boundLogic()->onMutexReleased(opdi::LogicInterface::MutexKind::Reduction,
+                                            opdi::backend->getReductionIdentifier());
 
         assert(nConstructorCalls == 3);
         nConstructorCalls = 0;
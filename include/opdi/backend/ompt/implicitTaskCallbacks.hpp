@@ -32,7 +32,7 @@
 #include "../../config.hpp"
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "callbacksBase.hpp"
 
@@ -58,14 +58,14 @@ namespace opdi {
         }
 
         if (ompt_scope_begin == endpoint) {
-          taskData->ptr = logic->onImplicitTaskBegin(false, actualParallelism, index, parallelData->ptr);
+          taskData->ptr = boundLogic()->onImplicitTaskBegin(false, actualParallelism, index, parallelData->ptr);
         }
         else {
           #if OPDI_OMPT_BACKEND_IMPLICIT_TASK_END_SOURCE == OPDI_OMPT_IMPLICIT_TASK_END
-            logic->onImplicitTaskEnd(taskData->ptr);
+            boundLogic()->onImplicitTaskEnd(taskData->ptr);
           #else
             if (index == 0)  // master thread always produces ImplicitTaskEnd here
-              logic->onImplicitTaskEnd(taskData->ptr);
+              boundLogic()->onImplicitTaskEnd(taskData->ptr);
           #endif
         }
       }
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "../../helpers/macros.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #define OPDI_PARALLEL(...) \
   OPDI_PRAGMA(omp parallel __VA_ARGS__)
@@ -89,9 +90,21 @@
 
 #define OPDI_END_MASKED
 
+// constructs in between are recorded without reverse synchronization, only use for constructs that protect passive data
+
+#define OPDI_NO_REVERSE_SYNC \
+  { \
+    opdi::boundLogic()->beginSkippedReverseSynchronization();
+
+#define OPDI_END_NO_REVERSE_SYNC \
+    opdi::boundLogic()->endSkippedReverseSynchronization(); \
+  }
+
 #define OPDI_BARRIER(...) \
   OPDI_PRAGMA(omp barrier __VA_ARGS__)
 
+#define OPDI_LOOP_CHUNK
+
 #if _OPENMP >= 202411
   #define OPDI_DECLARE_REDUCTION(OP_NAME, TYPE, OP, INIT) \
     OPDI_PRAGMA(omp declare_reduction(OP_NAME : TYPE) combiner(omp_out = omp_out OP omp_in) \
@@ -28,7 +28,7 @@
 #include "../../config.hpp"
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "callbacksBase.hpp"
 
@@ -54,7 +54,7 @@ namespace opdi {
           endpoint = LogicInterface::ScopeEndpoint::End;
         }
 
-        logic->onMasked(endpoint);
+        boundLogic()->onMasked(endpoint);
       }
 
     protected:
@@ -34,9 +34,10 @@
 
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "callbacksBase.hpp"
+#include "reverseSyncPolicy.hpp"
 #include "waitIdExtractor.hpp"
 
 namespace opdi {
@@ -54,17 +55,17 @@ namespace opdi {
         switch (kind) {
           case ompt_mutex_lock:
           case ompt_mutex_test_lock:
-            logic->onMutexDestroyed(LogicInterface::MutexKind::Lock, waitId);
+            boundLogic()->onMutexDestroyed(LogicInterface::MutexKind::Lock, waitId);
             break;
           case ompt_mutex_nest_lock:
           case ompt_mutex_test_nest_lock:
-            logic->onMutexDestroyed(LogicInterface::MutexKind::NestLock, waitId);
+            boundLogic()->onMutexDestroyed(LogicInterface::MutexKind::NestLock, waitId);
             break;
           case ompt_mutex_critical:
-            logic->onMutexDestroyed(LogicInterface::MutexKind::Critical, waitId);
+            boundLogic()->onMutexDestroyed(LogicInterface::MutexKind::Critical, waitId);
             break;
           case ompt_mutex_ordered:
-            logic->onMutexDestroyed(LogicInterface::MutexKind::Ordered, waitId);
+            boundLogic()->onMutexDestroyed(LogicInterface::MutexKind::Ordered, waitId);
             break;
           case ompt_mutex_atomic: // not supported, no AD handling
             break;
@@ -77,22 +78,23 @@ namespace opdi {
       static void onMutexAcquired(ompt_mutex_t kind,
                                   ompt_wait_id_t waitId,
                                   void const* codeptr) {
-        OPDI_UNUSED(codeptr);
+        // the logic skips the matching release event as well
+        bool isSkipped = ReverseSyncPolicy::beginEvent(codeptr);
 
         switch (kind) {
           case ompt_mutex_lock:
           case ompt_mutex_test_lock:
-            logic->onMutexAcquired(LogicInterface::MutexKind::Lock, waitId);
+            boundLogic()->onMutexAcquired(LogicInterface::MutexKind::Lock, waitId);
             break;
           case ompt_mutex_nest_lock:
           case ompt_mutex_test_nest_lock:
-            logic->onMutexAcquired(LogicInterface::MutexKind::NestLock, waitId);
+            boundLogic()->onMutexAcquired(LogicInterface::MutexKind::NestLock, waitId);
             break;
           case ompt_mutex_critical:
-            logic->onMutexAcquired(LogicInterface::MutexKind::Critical, waitId);
+            boundLogic()->onMutexAcquired(LogicInterface::MutexKind::Critical, waitId);
             break;
           case ompt_mutex_ordered:
-            logic->onMutexAcquired(LogicInterface::MutexKind::Ordered, waitId);
+            boundLogic()->onMutexAcquired(LogicInterface::MutexKind::Ordered, waitId);
             break;
           case ompt_mutex_atomic: // not supported, no AD handling
             break;
@@ -100,6 +102,10 @@ namespace opdi {
             OPDI_WARNING("Unknown kind argument.");
             break;
         }
+
+        if (isSkipped) {
+          ReverseSyncPolicy::endEvent();
+        }
       }
 
       static void onMutexReleased(ompt_mutex_t kind,
@@ -110,17 +116,17 @@ namespace opdi {
         switch (kind) {
           case ompt_mutex_lock:
           case ompt_mutex_test_lock:
-            logic->onMutexReleased(LogicInterface::MutexKind::Lock, waitId);
+            boundLogic()->onMutexReleased(LogicInterface::MutexKind::Lock, waitId);
             break;
           case ompt_mutex_nest_lock:
           case ompt_mutex_test_nest_lock:
-            logic->onMutexReleased(LogicInterface::MutexKind::NestLock, waitId);
+            boundLogic()->onMutexReleased(LogicInterface::MutexKind::NestLock, waitId);
             break;
           case ompt_mutex_critical:
-            logic->onMutexReleased(LogicInterface::MutexKind::Critical, waitId);
+            boundLogic()->onMutexReleased(LogicInterface::MutexKind::Critical, waitId);
             break;
           case ompt_mutex_ordered:
-            logic->onMutexReleased(LogicInterface::MutexKind::Ordered, waitId);
+            boundLogic()->onMutexReleased(LogicInterface::MutexKind::Ordered, waitId);
             break;
           case ompt_mutex_atomic: // not supported, no AD handling
             break;
@@ -48,6 +48,7 @@
 #include "mutexCallbacks.hpp"
 #include "parallelCallbacks.hpp"
 #include "reductionCallbacks.hpp"
+#include "reverseSyncPolicy.hpp"
 #include "syncRegionCallbacks.hpp"
 #include "waitIdExtractor.hpp"
 #include "workCallbacks.hpp"
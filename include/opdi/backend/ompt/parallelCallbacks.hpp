@@ -31,7 +31,7 @@
 
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "callbacksBase.hpp"
 
@@ -57,7 +57,7 @@ namespace opdi {
         OPDI_UNUSED(flags);
         OPDI_UNUSED(codeptr);
 
-        parallelData->ptr = logic->onParallelBegin(encounteringTaskData->ptr, requestedParallelism);
+        parallelData->ptr = boundLogic()->onParallelBegin(encounteringTaskData->ptr, requestedParallelism);
       }
 
       static void onParallelEnd(
@@ -70,7 +70,7 @@ namespace opdi {
         OPDI_UNUSED(flags);
         OPDI_UNUSED(codeptr);
 
-        logic->onParallelEnd(parallelData->ptr);
+        boundLogic()->onParallelEnd(parallelData->ptr);
       }
 
     protected:
@@ -31,7 +31,7 @@
 
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "../backendInterface.hpp"
 
@@ -57,10 +57,10 @@ namespace opdi {
         OPDI_UNUSED(codeptr);
 
         if (ompt_scope_begin == _endpoint) {
-          logic->onMutexAcquired(LogicInterface::MutexKind::Reduction, opdi::backend->getReductionIdentifier());
+          boundLogic()->onMutexAcquired(LogicInterface::MutexKind::Reduction, opdi::backend->getReductionIdentifier());
         }
         else {
-          logic->onMutexReleased(LogicInterface::MutexKind::Reduction, opdi::backend->getReductionIdentifier());
+          boundLogic()->onMutexReleased(LogicInterface::MutexKind::Reduction, opdi::backend->getReductionIdentifier());
         }
       }
 
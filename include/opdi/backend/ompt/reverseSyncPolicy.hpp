@@ -0,0 +1,66 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <unordered_set>
+
+#include "../../logic/boundLogic.hpp"
+
+namespace opdi {
+
+  // constructs that are recorded without reverse synchronization, identified by the codeptr of their OMPT callbacks
+  // for mutexes, the codeptr of the acquire event is decisive
+  struct ReverseSyncPolicy {
+    private:
+
+      static std::unordered_set<void const*> skipped;
+
+    public:
+
+      // not thread-safe! only use outside of parallel regions
+      static void skipReverseSynchronization(void const* codeptr) {
+        ReverseSyncPolicy::skipped.insert(codeptr);
+      }
+
+      // not thread-safe! only use outside of parallel regions
+      static void clear() {
+        ReverseSyncPolicy::skipped.clear();
+      }
+
+      // marks the begin of an event, returns whether endEvent has to be called
+      static bool beginEvent(void const* codeptr) {
+        if (!ReverseSyncPolicy::skipped.empty() && ReverseSyncPolicy::skipped.count(codeptr) != 0) {
+          boundLogic()->beginSkippedReverseSynchronization();
+          return true;
+        }
+        return false;
+      }
+
+      static void endEvent() {
+        boundLogic()->endSkippedReverseSynchronization();
+      }
+  };
+}
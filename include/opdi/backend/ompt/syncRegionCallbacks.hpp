@@ -31,9 +31,10 @@
 
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "callbacksBase.hpp"
+#include "reverseSyncPolicy.hpp"
 
 namespace opdi {
 
@@ -50,7 +51,6 @@ namespace opdi {
           void const* codeptr) {
 
         OPDI_UNUSED(parallelData);
-        OPDI_UNUSED(codeptr);
 
         #if OPDI_OMPT_BACKEND_IMPLICIT_TASK_END_SOURCE != OPDI_SYNC_REGION_END
           OPDI_UNUSED(taskData);
@@ -64,9 +64,18 @@ namespace opdi {
           endpoint = LogicInterface::ScopeEndpoint::End;
         }
 
+        // implicit barriers of parallel regions are excluded, they might end the implicit task
+        #if _OPENMP >= 202011
+          bool isImplicitParallel = (ompt_sync_region_barrier_implicit_parallel == kind);
+        #else  // fallback for compilers with _OPENMP < 202011 that already support fine-grained sync region types
+          bool isImplicitParallel = (9 == kind);  // ompt_sync_region_barrier_implicit_parallel
+        #endif
+
+        bool isSkipped = !isImplicitParallel && ReverseSyncPolicy::beginEvent(codeptr);
+
         switch (kind) {
           case ompt_sync_region_barrier:
-            logic->onSyncRegion(LogicInterface::SyncRegionKind::Barrier, endpoint);
+            boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::Barrier, endpoint);
             break;
           case ompt_sync_region_barrier_implicit:
         #if _OPENMP >= 202011
@@ -74,17 +83,17 @@ namespace opdi {
         #else  // fallback for compilers with _OPENMP < 202011 that already support fine-grained sync region types
           case 8:  // ompt_sync_region_barrier_implicit_workshare
         #endif
-            logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplicit, endpoint);
+            boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplicit, endpoint);
             break;
           case ompt_sync_region_barrier_explicit:
-            logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierExplicit, endpoint);
+            boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierExplicit, endpoint);
             break;
           case ompt_sync_region_barrier_implementation:
           #if OPDI_OMPT_BACKEND_BARRIER_IMPLEMENTATION_BEHAVIOUR == OPDI_PAIR_OF_AD_EVENTS_PER_ENDPOINT
-            logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation, LogicInterface::ScopeEndpoint::Begin);
-            logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation, LogicInterface::ScopeEndpoint::End);
+            boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation, LogicInterface::ScopeEndpoint::Begin);
+            boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation, LogicInterface::ScopeEndpoint::End);
           #else
-            logic->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation, endpoint);
+            boundLogic()->onSyncRegion(LogicInterface::SyncRegionKind::BarrierImplementation, endpoint);
           #endif
             break;
         #if _OPENMP >= 202011
@@ -96,7 +105,7 @@ namespace opdi {
             // however, we optionally use this to generate ImplicitTaskEnd events of non-master threads
           #if OPDI_OMPT_BACKEND_IMPLICIT_TASK_END_SOURCE == OPDI_OMPT_SYNC_REGION_END
             if (LogicInterface::ScopeEndpoint::Begin == endpoint && omp_get_thread_num() != 0) {
-              opdi::logic->onImplicitTaskEnd(taskData->ptr);
+              opdi::boundLogic()->onImplicitTaskEnd(taskData->ptr);
             }
           #endif
             break;  // no treatment needed
@@ -110,6 +119,10 @@ namespace opdi {
             OPDI_WARNING("Unknown kind argument.");
             break;
         }
+
+        if (isSkipped) {
+          ReverseSyncPolicy::endEvent();
+        }
       }
 
     protected:
@@ -29,9 +29,10 @@
 #include <omp.h>
 #include <omp-tools.h>
 
+#include "../../config.hpp"
 #include "../../helpers/exceptions.hpp"
 #include "../../helpers/macros.hpp"
-#include "../../logic/logicInterface.hpp"
+#include "../../logic/boundLogic.hpp"
 
 #include "callbacksBase.hpp"
 
@@ -76,14 +77,14 @@ namespace opdi {
           case 12:  // ompt_work_loop_guided
           case 13:  // ompt_work_loop_other
         #endif
-            logic->onWork(LogicInterface::WorksharingKind::Loop, endpoint);
+            boundLogic()->onWork(LogicInterface::WorksharingKind::Loop, endpoint);
             break;
           case ompt_work_sections:
-            logic->onWork(LogicInterface::WorksharingKind::Sections, endpoint);
+            boundLogic()->onWork(LogicInterface::WorksharingKind::Sections, endpoint);
             break;
           case ompt_work_single_executor:
           case ompt_work_single_other:
-            logic->onWork(LogicInterface::WorksharingKind::Single, endpoint);
+            boundLogic()->onWork(LogicInterface::WorksharingKind::Single, endpoint);
             break;
           case ompt_work_workshare:  // not supported, no AD handling
           case ompt_work_distribute:
@@ -95,15 +96,49 @@ namespace opdi {
         }
       }
 
+      static void onDispatch(
+          ompt_data_t* parallelData,
+          ompt_data_t* taskData,
+          ompt_dispatch_t kind,
+          ompt_data_t instance) {
+
+        OPDI_UNUSED(parallelData);
+        OPDI_UNUSED(taskData);
+        OPDI_UNUSED(instance);
+
+        switch (kind) {
+          case ompt_dispatch_iteration:
+        #if _OPENMP >= 202111
+          case ompt_dispatch_ws_loop_chunk:
+        #else  // fallback for compilers with _OPENMP < 202111 that already support chunk dispatch
+          case 3:  // ompt_dispatch_ws_loop_chunk
+        #endif
+            boundLogic()->onLoopChunk();
+            break;
+          default:  // sections are not split into chunks
+            break;
+        }
+      }
+
     protected:
 
       static void init() {
 
         OPDI_CHECK_ERROR(CallbacksBase::registerCallback(ompt_callback_work, (ompt_callback_t) WorkCallbacks::onWork));
+
+        #if OPDI_REVERSE_LOOP_WORK_STEALING
+          if (!CallbacksBase::registerCallback(ompt_callback_dispatch, (ompt_callback_t) WorkCallbacks::onDispatch)) {
+            OPDI_WARNING("Dispatch events are not supported, loops are not split into chunks for the reverse pass.");
+          }
+        #endif
       }
 
       static void finalize() {
 
+        #if OPDI_REVERSE_LOOP_WORK_STEALING
+          CallbacksBase::clearCallback(ompt_callback_dispatch);
+        #endif
+
         OPDI_CHECK_ERROR(CallbacksBase::clearCallback(ompt_callback_work));
       }
   };
@@ -38,6 +38,7 @@
 
 #define OPDI_ADJOINT_ACCESS_ATOMIC 1
 #define OPDI_ADJOINT_ACCESS_CLASSICAL 2
+#define OPDI_ADJOINT_ACCESS_PRIVATIZED 3
 
 #define OPDI_SCOPE_ENDPOINT_BEGIN 1
 #define OPDI_SCOPE_ENDPOINT_END 2
@@ -49,6 +50,14 @@
 #define OPDI_PAIR_OF_AD_EVENTS_PER_ENDPOINT 1
 #define OPDI_SINGLE_AD_EVENT_PER_ENDPOINT 2
 
+#define OPDI_WAIT_SPIN 1
+#define OPDI_WAIT_SPIN_YIELD 2
+#define OPDI_WAIT_SPIN_PARK 3
+
+#define OPDI_REVERSE_BARRIER_OMP 1
+#define OPDI_REVERSE_BARRIER_CENTRAL 2
+#define OPDI_REVERSE_BARRIER_DISSEMINATION 3
+
 /* ------------------ configuration ------------------ */
 
 /* ----- backend configuration ----- */
@@ -75,6 +84,10 @@ static_assert(OPDI_OMPT_BACKEND_IMPLICIT_TASK_END_SOURCE <= 2);
 static_assert(0 < OPDI_OMPT_BACKEND_BARRIER_IMPLEMENTATION_BEHAVIOUR);
 static_assert(OPDI_OMPT_BACKEND_BARRIER_IMPLEMENTATION_BEHAVIOUR <= 2);
 
+#ifndef OPDI_STATIC_LOGIC
+  #define OPDI_STATIC_LOGIC 0
+#endif
+
 /* ----- logic configuration ----- */
 
 /* general logic options */
@@ -92,7 +105,7 @@ static_assert(OPDI_OMPT_BACKEND_BARRIER_IMPLEMENTATION_BEHAVIOUR <= 2);
 #endif
 
 static_assert(0 < OPDI_DEFAULT_ADJOINT_ACCESS_MODE);
-static_assert(OPDI_DEFAULT_ADJOINT_ACCESS_MODE <= 2);
+static_assert(OPDI_DEFAULT_ADJOINT_ACCESS_MODE <= 3);
 
 #ifndef OPDI_OMP_LOGIC_CLEAR_ADJOINTS
   #define OPDI_OMP_LOGIC_CLEAR_ADJOINTS 0
@@ -135,6 +148,107 @@ static_assert(OPDI_SYNC_REGION_BARRIER_IMPLEMENTATION_BEHAVIOUR <= 3);
 static_assert(0 < OPDI_SYNC_REGION_BARRIER_REVERSE_BEHAVIOUR);
 static_assert(OPDI_SYNC_REGION_BARRIER_REVERSE_BEHAVIOUR <= 3);
 
+#ifndef OPDI_REVERSE_BARRIER_COALESCING
+  #define OPDI_REVERSE_BARRIER_COALESCING 0
+#endif
+
+#ifndef OPDI_REVERSE_BARRIER
+  #define OPDI_REVERSE_BARRIER OPDI_REVERSE_BARRIER_OMP
+#endif
+
+static_assert(0 < OPDI_REVERSE_BARRIER);
+static_assert(OPDI_REVERSE_BARRIER <= 3);
+
+#ifndef OPDI_REVERSE_BARRIER_WAIT_POLICY
+  #define OPDI_REVERSE_BARRIER_WAIT_POLICY OPDI_WAIT_SPIN_PARK
+#endif
+
+static_assert(0 < OPDI_REVERSE_BARRIER_WAIT_POLICY);
+static_assert(OPDI_REVERSE_BARRIER_WAIT_POLICY <= 3);
+
+/* reverse loop behaviour */
+
+// loop work stealing requires a tool that supports concurrent evaluation of one tape
+// chunks of a thread must not depend on each other, e.g., via accumulation into private variables across chunks
+
+#ifndef OPDI_REVERSE_LOOP_WORK_STEALING
+  #define OPDI_REVERSE_LOOP_WORK_STEALING 0
+#endif
+
+static_assert(!OPDI_REVERSE_LOOP_WORK_STEALING || OPDI_BACKEND_GENERATE_WORK_EVENTS);
+
+#ifndef OPDI_REVERSE_LOOP_WAIT_POLICY
+  #define OPDI_REVERSE_LOOP_WAIT_POLICY OPDI_WAIT_SPIN_PARK
+#endif
+
+static_assert(0 < OPDI_REVERSE_LOOP_WAIT_POLICY);
+static_assert(OPDI_REVERSE_LOOP_WAIT_POLICY <= 3);
+
+/* reverse mutex behaviour */
+
+#ifndef OPDI_REVERSE_MUTEX_WAIT_POLICY
+  #define OPDI_REVERSE_MUTEX_WAIT_POLICY OPDI_WAIT_SPIN
+#endif
+
+static_assert(0 < OPDI_REVERSE_MUTEX_WAIT_POLICY);
+static_assert(OPDI_REVERSE_MUTEX_WAIT_POLICY <= 3);
+
+#ifndef OPDI_WAIT_SPIN_COUNT
+  #define OPDI_WAIT_SPIN_COUNT 1000
+#endif
+
+static_assert(0 <= OPDI_WAIT_SPIN_COUNT);
+
+/* reverse parallel region behaviour */
+
+#ifndef OPDI_PERSISTENT_REVERSE_TEAM
+  #define OPDI_PERSISTENT_REVERSE_TEAM 0
+#endif
+
+#ifndef OPDI_ELASTIC_REVERSE_TEAM
+  #define OPDI_ELASTIC_REVERSE_TEAM 0
+#endif
+
+// stack size of the fibers that run logical threads, must also hold the reverse pass of nested parallel regions
+#ifndef OPDI_ELASTIC_REVERSE_TEAM_STACK_SIZE
+  #define OPDI_ELASTIC_REVERSE_TEAM_STACK_SIZE (1 << 20)
+#endif
+
+static_assert(0 < OPDI_ELASTIC_REVERSE_TEAM_STACK_SIZE);
+
+#ifndef OPDI_REVERSE_SERIAL_THRESHOLD
+  #define OPDI_REVERSE_SERIAL_THRESHOLD 0
+#endif
+
+static_assert(0 <= OPDI_REVERSE_SERIAL_THRESHOLD);
+
+#ifndef OPDI_REVERSE_TEAM_WAIT_POLICY
+  #define OPDI_REVERSE_TEAM_WAIT_POLICY OPDI_WAIT_SPIN_PARK
+#endif
+
+static_assert(0 < OPDI_REVERSE_TEAM_WAIT_POLICY);
+static_assert(OPDI_REVERSE_TEAM_WAIT_POLICY <= 3);
+
+/* tape cleanup behaviour */
+
+#ifndef OPDI_DEFERRED_TAPE_CLEANUP
+  #define OPDI_DEFERRED_TAPE_CLEANUP 0
+#endif
+
+/* ----- memory management ----- */
+
+#ifndef OPDI_BLOCK_POOL
+  #define OPDI_BLOCK_POOL 1
+#endif
+
+#ifndef OPDI_BLOCK_POOL_REUSE_MEMORY
+  #define OPDI_BLOCK_POOL_REUSE_MEMORY 1
+#endif
+
+#ifndef OPDI_RECYCLE_LOGIC_DATA
+  #define OPDI_RECYCLE_LOGIC_DATA 1
+#endif
+
 /* ----- error handling ----- */
 
 #ifndef OPDI_ENABLE_WARNINGS
@@ -59,8 +59,13 @@
 #define OPDI_MASKED(...)
 #define OPDI_END_MASKED
 
+#define OPDI_NO_REVERSE_SYNC
+#define OPDI_END_NO_REVERSE_SYNC
+
 #define OPDI_BARRIER(...)
 
+#define OPDI_LOOP_CHUNK
+
 #define OPDI_DECLARE_REDUCTION(...)
 
 #define OPDI_REDUCTION
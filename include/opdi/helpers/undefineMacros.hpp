@@ -57,8 +57,13 @@
 #undef OPDI_MASKED
 #undef OPDI_END_MASKED
 
+#undef OPDI_NO_REVERSE_SYNC
+#undef OPDI_END_NO_REVERSE_SYNC
+
 #undef OPDI_BARRIER
 
+#undef OPDI_LOOP_CHUNK
+
 #undef OPDI_DECLARE_REDUCTION
 
 #undef OPDI_REDUCTION
@@ -0,0 +1,78 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+
+#include "../config.hpp"
+
+#include "logicInterface.hpp"
+
+#if OPDI_STATIC_LOGIC
+  #include "omp/ompLogic.hpp"
+#endif
+
+/* If OPDI_STATIC_LOGIC is enabled, the backends access the logic through a final class derived from OmpLogic. Calls
+ * from the backends into the logic can then be bound at compile time and inlined. The logic must be created as
+ * opdi::BoundLogic.
+ *
+ * Otherwise, the logic is accessed through the virtual LogicInterface.
+ */
+
+namespace opdi {
+
+#if OPDI_STATIC_LOGIC
+
+  struct BoundLogic final : public OmpLogic {
+    public:
+
+      // LogicInterface is a virtual base, hence the logic pointer cannot be cast statically
+      static BoundLogic* instance;
+
+      BoundLogic() {
+        BoundLogic::instance = this;
+      }
+
+      virtual ~BoundLogic() {
+        BoundLogic::instance = nullptr;
+      }
+  };
+
+  inline BoundLogic* boundLogic() {
+    assert(static_cast<LogicInterface*>(BoundLogic::instance) == logic);  // logic must be an opdi::BoundLogic
+    return BoundLogic::instance;
+  }
+
+#else
+
+  using BoundLogic = LogicInterface;
+
+  inline BoundLogic* boundLogic() {
+    return logic;
+  }
+
+#endif
+}
@@ -51,8 +51,9 @@ namespace opdi {
         Loop, Sections, Single
       };
 
+      // privatized parts must not use values that other threads compute in the same parallel region
       enum AdjointAccessMode {
-        Atomic, Classical
+        Atomic, Classical, Privatized
       };
 
       using WaitId = std::size_t;
@@ -72,6 +73,7 @@ namespace opdi {
       virtual void registerInactiveMutex(MutexKind kind, WaitId waitId) = 0;
 
       virtual void onWork(WorksharingKind kind, ScopeEndpoint endpoint) = 0;
+      virtual void onLoopChunk() = 0;
 
       virtual void onMasked(ScopeEndpoint endpoint) = 0;
 
@@ -83,6 +85,8 @@ namespace opdi {
       virtual void postEvaluate() = 0;
       virtual void reset() = 0;
 
+      virtual void reserveTapes(int nestingDepth, int sizeOfTeam, std::size_t expectedTapeSize) = 0;
+
       virtual void* exportState() = 0;
       virtual void freeState(void* state) = 0;
       virtual void recoverState(void* state) = 0;
@@ -90,11 +94,23 @@ namespace opdi {
       virtual void setAdjointAccessMode(AdjointAccessMode mode) = 0;
       virtual AdjointAccessMode getAdjointAccessMode() const = 0;
 
+      // adjoints of identifiers begin, ..., end - 1 are updated by no other thread while the current implicit task is
+      // evaluated, atomic parts of the implicit task update them without atomics
+      virtual void addOwnedAdjoints(std::size_t begin, std::size_t end) = 0;
+
       virtual void resetImplicitTask(void* position, AdjointAccessMode mode) = 0;
 
+      // the activity of the thread-local tape is cached in parallel regions
+      // must be called after setting the tape active or passive inside a parallel region
+      virtual void updateTapeActivity() = 0;
+
       virtual void addReverseBarrier() = 0;
       virtual void addReverseFlush() = 0;
 
+      // sync regions and mutexes in between are recorded without reverse synchronization, pairs may be nested
+      virtual void beginSkippedReverseSynchronization() = 0;
+      virtual void endSkippedReverseSynchronization() = 0;
+
       virtual void beginSkippedParallelRegion() = 0;
       virtual void endSkippedParallelRegion() = 0;
   };
@@ -0,0 +1,53 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../config.hpp"
+#include "../../tool/boundTool.hpp"
+
+#include "instrument/ompLogicInstrumentInterface.hpp"
+
+#include "flushOmpLogic.hpp"
+#include "recordingState.hpp"
+
+void opdi::FlushOmpLogic::reverseFunc(void*) {
+
+  #if OPDI_OMP_LOGIC_INSTRUMENT
+    for (auto& instrument : ompLogicInstruments) {
+      instrument->reverseFlush();
+    }
+  #endif
+
+  #pragma omp flush
+}
+
+void opdi::FlushOmpLogic::addReverseFlush() {
+  if (RecordingState::isRecording()) {
+
+    InlineHandle handle;
+    handle.reverseFunc = FlushOmpLogic::reverseFunc;
+    boundTool()->pushInlineExternalFunction(boundTool()->getThreadLocalTape(), handle);
+    ++RecordingState::nSynchronizingHandles;
+  }
+}
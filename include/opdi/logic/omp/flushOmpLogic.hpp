@@ -30,33 +30,15 @@
 
 #include "../logicInterface.hpp"
 
-#include "instrument/ompLogicInstrumentInterface.hpp"
-
 namespace opdi {
 
   struct FlushOmpLogic : public virtual LogicInterface {
     private:
 
-      static void reverseFunc(void*) {
-
-        #if OPDI_OMP_LOGIC_INSTRUMENT
-          for (auto& instrument : ompLogicInstruments) {
-            instrument->reverseFlush();
-          }
-        #endif
-
-        #pragma omp flush
-      }
+      static void reverseFunc(void*);
 
     public:
 
-      virtual void addReverseFlush() {
-        if (tool != nullptr && tool->getThreadLocalTape() != nullptr && tool->isActive(tool->getThreadLocalTape())) {
-
-          Handle* handle = new Handle;
-          handle->reverseFunc = FlushOmpLogic::reverseFunc;
-          tool->pushExternalFunction(tool->getThreadLocalTape(), handle);
-        }
-      }
+      virtual void addReverseFlush();
   };
 }
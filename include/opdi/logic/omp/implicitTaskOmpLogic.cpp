@@ -28,20 +28,13 @@
 #include "../../backend/backendInterface.hpp"
 #include "../../config.hpp"
 #include "../../helpers/exceptions.hpp"
-#include "../../tool/toolInterface.hpp"
+#include "../../tool/boundTool.hpp"
 
 #include "instrument/ompLogicInstrumentInterface.hpp"
 
 #include "implicitTaskOmpLogic.hpp"
 #include "parallelOmpLogic.hpp"
-
-void opdi::ImplicitTaskOmpLogic::internalInit() {
-  this->tapePool.init();
-}
-
-void opdi::ImplicitTaskOmpLogic::internalFinalize() {
-  this->tapePool.finalize();
-}
+#include "recordingState.hpp"
 
 void* opdi::ImplicitTaskOmpLogic::onImplicitTaskBegin(bool isInitialImplicitTask, int actualSizeOfTeam, int indexInTeam,
                                                       void* parallelDataPtr) {
@@ -51,7 +44,9 @@ void* opdi::ImplicitTaskOmpLogic::onImplicitTaskBegin(bool isInitialImplicitTask
   // check if the handling of the parallel region was skipped
   if (parallelData != nullptr || isInitialImplicitTask) {
 
-    ImplicitTaskData* implicitTaskData = new ImplicitTaskData;
+    ImplicitTaskData* implicitTaskData = RecyclingPool<ImplicitTaskData>::get();
+    implicitTaskData->positions.clear();  // recycled data keeps its memory
+    implicitTaskData->adjointAccessModes.clear();
     implicitTaskData->isInitialImplicitTask = isInitialImplicitTask;
     implicitTaskData->level = omp_get_level();
     implicitTaskData->indexInTeam = indexInTeam;
@@ -70,55 +65,66 @@ void* opdi::ImplicitTaskOmpLogic::onImplicitTaskBegin(bool isInitialImplicitTask
         parallelData->actualSizeOfTeam = actualSizeOfTeam;
       }
 
-      implicitTaskData->oldTape = tool->getThreadLocalTape();
+      implicitTaskData->oldTape = boundTool()->getThreadLocalTape();
       assert(implicitTaskData->oldTape != nullptr);
       implicitTaskData->parallelData = parallelData;
 
-      void* newTape = this->tapePool.getTape(parallelData->encounteringTaskTape, indexInTeam);
+      void* newTape = parallelData->childTapes[indexInTeam];
 
       if (parallelData->isActiveParallelRegion) {
         // most recent tape activity change *per thread* reflects the current activity
         if (indexInTeam == 0) {
-          tool->setActive(implicitTaskData->oldTape, false);  // suspend recording on encountering task's tape
+          boundTool()->setActive(implicitTaskData->oldTape, false);  // suspend recording on encountering task's tape
         }
-        tool->setActive(newTape, true);
+        boundTool()->setActive(newTape, true);
       }
 
       implicitTaskData->newTape = newTape;
 
-      implicitTaskData->positions.push_back(tool->allocPosition());
-      tool->getTapePosition(newTape, implicitTaskData->positions.back());
+      implicitTaskData->positions.setPositionSize(boundTool()->getPositionSize());
+      boundTool()->getTapePosition(newTape, implicitTaskData->positions.push_back());
 
-      tool->setThreadLocalTape(newTape);
+      boundTool()->setThreadLocalTape(newTape);
 
       implicitTaskData->adjointAccessModes.push_back(parallelData->encounteringTaskAdjointAccessMode);
+      implicitTaskData->ownedAdjoints.clear();
 
       parallelData->childTaskData[indexInTeam] = implicitTaskData;
 
-      // check for copies due to firstprivate/copyin that were recorded on the wrong tapes
-      // move them to the correct tapes if needed
-
-      void* oldTapePosition = tool->allocPosition();
-      tool->getTapePosition(implicitTaskData->oldTape, oldTapePosition);
-
-      void* referencePosition = tool->allocPosition();
-      if (indexInTeam == 0) {
-        tool->copyPosition(referencePosition, parallelData->encounteringTaskTapePosition);
+      #if OPDI_REVERSE_LOOP_WORK_STEALING
+        implicitTaskData->loops.clear();
+        implicitTaskData->loopChunkPositions.clear();
+        implicitTaskData->loopChunkPositions.setPositionSize(boundTool()->getPositionSize());
+      #endif
+
+      #if OPDI_REVERSE_BARRIER_COALESCING
+        implicitTaskData->nReverseBarriers = 0;
+        implicitTaskData->reverseBarrierPositions.clear();
+        implicitTaskData->reverseBarrierPositions.setPositionSize(boundTool()->getPositionSize());
+        boundTool()->copyPosition(implicitTaskData->reverseBarrierPositions.push_back(),
+                                  implicitTaskData->positions.front());
+        implicitTaskData->reverseBarrierPositions.push_back();
+      #endif
+
+      implicitTaskData->wasInPassiveParallelRegion = RecordingState::inPassiveParallelRegion;
+      RecordingState::inPassiveParallelRegion = !parallelData->isActiveParallelRegion;
+
+      implicitTaskData->encounteringTapeActivity = RecordingState::tapeActivity;
+      if (parallelData->isActiveParallelRegion) {
+        RecordingState::tapeActivity = RecordingState::TapeActivity::Active;
       }
       else {
-        tool->getZeroPosition(implicitTaskData->oldTape, referencePosition);
-      }
-
-      if (tool->comparePosition(oldTapePosition, referencePosition) > 0) {
-        // users should ensure that activity of default tapes and encountering task's tape match
-        assert(parallelData->isActiveParallelRegion);
+        RecordingState::tapeActivity = RecordingState::TapeActivity::Passive;
 
-        tool->append(newTape, implicitTaskData->oldTape, referencePosition, oldTapePosition);
-        tool->erase(implicitTaskData->oldTape, referencePosition, oldTapePosition);
+        // the parallel end event is pending from the start
+        parallelData->nPendingEvents.fetch_add(1);
       }
 
-      tool->freePosition(referencePosition);
-      tool->freePosition(oldTapePosition);
+      // scopes without reverse synchronization do not extend to nested parallel regions
+      implicitTaskData->encounteringSkipReverseSynchronizationDepth = RecordingState::skipReverseSynchronizationDepth;
+      RecordingState::skipReverseSynchronizationDepth = 0;
+
+      implicitTaskData->nSynchronizingHandles = RecordingState::nSynchronizingHandles;
     }
     else {
       implicitTaskData->oldTape = nullptr;
@@ -128,6 +134,31 @@ void* opdi::ImplicitTaskOmpLogic::onImplicitTaskBegin(bool isInitialImplicitTask
       implicitTaskData->adjointAccessModes.push_back(ImplicitTaskOmpLogic::defaultAdjointAccessMode);
     }
 
+    // check for copies due to firstprivate/copyin that were recorded on the wrong tapes
+    // move them to the correct tapes if needed
+    // there are no such copies in passive parallel regions
+    if (!isInitialImplicitTask && parallelData->isActiveParallelRegion) {
+
+      void* oldTapePosition = boundTool()->allocPosition();
+      boundTool()->getTapePosition(implicitTaskData->oldTape, oldTapePosition);
+
+      void* referencePosition = boundTool()->allocPosition();
+      if (indexInTeam == 0) {
+        boundTool()->copyPosition(referencePosition, parallelData->encounteringTaskTapePosition);
+      }
+      else {
+        boundTool()->getZeroPosition(implicitTaskData->oldTape, referencePosition);
+      }
+
+      if (boundTool()->comparePosition(oldTapePosition, referencePosition) > 0) {
+        boundTool()->append(implicitTaskData->newTape, implicitTaskData->oldTape, referencePosition, oldTapePosition);
+        boundTool()->erase(implicitTaskData->oldTape, referencePosition, oldTapePosition);
+      }
+
+      boundTool()->freePosition(referencePosition);
+      boundTool()->freePosition(oldTapePosition);
+    }
+
     #if OPDI_OMP_LOGIC_INSTRUMENT
       for (auto& instrument : ompLogicInstruments) {
         instrument->onImplicitTaskBegin(implicitTaskData);
@@ -155,30 +186,65 @@ void opdi::ImplicitTaskOmpLogic::onImplicitTaskEnd(void* implicitTaskDataPtr) {
     if (!implicitTaskData->isInitialImplicitTask) {
       assert(tool != nullptr);
 
-      tool->setThreadLocalTape(implicitTaskData->oldTape);
+      boundTool()->setThreadLocalTape(implicitTaskData->oldTape);
+
+      boundTool()->getTapePosition(implicitTaskData->newTape, implicitTaskData->positions.push_back());
 
-      implicitTaskData->positions.push_back(tool->allocPosition());
-      tool->getTapePosition(implicitTaskData->newTape, implicitTaskData->positions.back());
+      RecordingState::inPassiveParallelRegion = implicitTaskData->wasInPassiveParallelRegion;
+      RecordingState::tapeActivity = implicitTaskData->encounteringTapeActivity;
+      RecordingState::skipReverseSynchronizationDepth = implicitTaskData->encounteringSkipReverseSynchronizationDepth;
+
+      implicitTaskData->nSynchronizingHandles = RecordingState::nSynchronizingHandles -
+                                                implicitTaskData->nSynchronizingHandles;
 
       if (!implicitTaskData->parallelData->isActiveParallelRegion) {
-        if (tool->comparePosition(implicitTaskData->positions.front(), implicitTaskData->positions.back()) != 0) {
+        if (boundTool()->comparePosition(implicitTaskData->positions.front(),
+                                         implicitTaskData->positions.back()) != 0) {
           OPDI_ERROR("Something became active during a passive parallel region. This is not supported and will not be",
                      "differentiated correctly.");
         }
+
+        ImplicitTaskOmpLogic::releasePassiveParallelRegion(implicitTaskData->parallelData);
       }
       else {
         // most recent tape activity change *per thread* reflects the current activity
-        tool->setActive(implicitTaskData->newTape, false);
+        boundTool()->setActive(implicitTaskData->newTape, false);
         if (implicitTaskData->indexInTeam == 0) {
-          tool->setActive(implicitTaskData->oldTape, true);  // resume recording on encountering task's tape
+          boundTool()->setActive(implicitTaskData->oldTape, true);  // resume recording on encountering task's tape
         }
+
+        // do not delete data, it is deleted as part of parallel regions
       }
+    }
+    else {
+      // recycle task data, there is no parallel region to do so
+      RecyclingPool<ImplicitTaskData>::recycle(implicitTaskData);
+    }
+  }
+}
+
+void opdi::ImplicitTaskOmpLogic::releasePassiveParallelRegion(ParallelData* parallelData) {
 
-      // do not delete data, it is deleted as part of parallel regions
+  // the parallel end event might occur before or after the implicit task end events
+  // it occurs after all implicit task begin events, hence the count of pending events only drops to zero at the end
+  if (parallelData->nPendingEvents.fetch_sub(1) == 1) {
+    for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+      RecyclingPool<ImplicitTaskData>::recycle(parallelData->childTaskData[i]);
+    }
+    RecyclingPool<ParallelData>::recycle(parallelData);
+  }
+}
+
+void opdi::ImplicitTaskOmpLogic::updateTapeActivity() {
+
+  // passive parallel regions remain passive, outside of parallel regions, the activity is not cached
+  if (!RecordingState::inPassiveParallelRegion &&
+      RecordingState::tapeActivity != RecordingState::TapeActivity::Unknown) {
+    if (RecordingState::isTapeActive()) {
+      RecordingState::tapeActivity = RecordingState::TapeActivity::Active;
     }
     else {
-      // delete task data, there is no parallel region to do so
-      delete implicitTaskData;
+      RecordingState::tapeActivity = RecordingState::TapeActivity::Passive;
     }
   }
 }
@@ -193,13 +259,24 @@ void opdi::ImplicitTaskOmpLogic::resetImplicitTask(void* position, opdi::LogicIn
     if (!implicitTaskData->isInitialImplicitTask) {
       assert(tool != nullptr);
 
-      assert(tool->comparePosition(implicitTaskData->positions.front(), position) <= 0);
+      assert(boundTool()->comparePosition(implicitTaskData->positions.front(), position) <= 0);
 
-      while (tool->comparePosition(implicitTaskData->positions.back(), position) > 0) {
-        tool->freePosition(implicitTaskData->positions.back());
+      while (boundTool()->comparePosition(implicitTaskData->positions.back(), position) > 0) {
         implicitTaskData->positions.pop_back();
         implicitTaskData->adjointAccessModes.pop_back();
       }
+
+      #if OPDI_REVERSE_LOOP_WORK_STEALING
+        // discarded loops can no longer be matched with the loops of the other threads
+        std::deque<LoopData>& loops = implicitTaskData->loops;
+        while (!loops.empty() && (loops.back().isOpen || loops.back().part >= implicitTaskData->positions.size())) {
+          while (implicitTaskData->loopChunkPositions.size() > loops.back().firstChunk) {
+            implicitTaskData->loopChunkPositions.pop_back();
+          }
+          loops.pop_back();
+          implicitTaskData->parallelData->isLoopWorkStealingDisabled.store(true);
+        }
+      #endif
     }
 
     implicitTaskData->adjointAccessModes.back() = mode;
@@ -26,12 +26,16 @@
 #pragma once
 
 #include <deque>
+#include <vector>
 
-#include "../../misc/tapePool.hpp"
+#include "../../misc/positionBuffer.hpp"
+#include "../../tool/toolInterface.hpp"
 
 #include "../logicInterface.hpp"
 
 #include "parallelOmpLogic.hpp"
+#include "recordingState.hpp"
+#include "workOmpLogic.hpp"
 
 namespace opdi {
 
@@ -43,17 +47,20 @@ namespace opdi {
       void* oldTape;
       void* newTape;
       ParallelData* parallelData;
-      std::deque<void*> positions;
-      std::deque<LogicInterface::AdjointAccessMode> adjointAccessModes;
+      bool wasInPassiveParallelRegion;
+      RecordingState::TapeActivity encounteringTapeActivity;
+      int encounteringSkipReverseSynchronizationDepth;
+      std::size_t nSynchronizingHandles;  // recorded in the implicit task, the initial thread-local count until it ends
+      PositionBuffer positions;
+      std::vector<LogicInterface::AdjointAccessMode> adjointAccessModes;
+      std::vector<ToolInterface::AdjointRange> ownedAdjoints;  // sorted and disjoint
+      std::size_t nReverseBarriers;
+      PositionBuffer reverseBarrierPositions;  // position after the previous reverse barrier and a scratch position
+      std::deque<LoopData> loops;  // worksharing loops in the order of recording
+      PositionBuffer loopChunkPositions;  // chunk boundaries of all loops
   };
 
   struct ImplicitTaskOmpLogic : public virtual LogicInterface {
-    protected:
-      TapePool tapePool;
-
-      void internalInit();
-      void internalFinalize();
-
     public:
 
       using LogicInterface::AdjointAccessMode;
@@ -65,5 +72,10 @@ namespace opdi {
       virtual void onImplicitTaskEnd(void* implicitTaskData);
 
       virtual void resetImplicitTask(void* position, AdjointAccessMode mode);
+
+      virtual void updateTapeActivity();
+
+      // recycles the data once all events of the passive parallel region have occurred
+      static void releasePassiveParallelRegion(ParallelData* parallelData);
   };
 }
@@ -0,0 +1,177 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "../../../misc/output.hpp"
+#include "../../../tool/toolInterface.hpp"
+
+#include "ompLogicInstrumentInterface.hpp"
+
+namespace opdi {
+
+  // checks the adjoint access modes of parallel regions before they are evaluated
+  // for each part of each implicit task, the identifiers whose adjoints are read and updated are obtained from the tool
+  // parts are reported if they can be evaluated in classical mode, or if their mode is not safe
+  // adjoint updates of different threads are considered concurrent throughout the parallel region
+  struct OmpLogicAdjointAccessInstrument : public OmpLogicInstrumentInterface {
+    private:
+
+      static int constexpr severalThreads = -1;
+
+      struct Part {
+        public:
+          std::vector<std::size_t> read;
+          std::vector<std::size_t> updated;
+      };
+
+      std::atomic<bool> isSupported;
+
+      static void addUpdate(std::unordered_map<std::size_t, int>& updatingThread, std::size_t identifier, int thread) {
+        auto result = updatingThread.emplace(identifier, thread);
+        if (!result.second && result.first->second != thread) {
+          result.first->second = severalThreads;
+        }
+      }
+
+      static bool isOwned(ImplicitTaskData* data, std::size_t identifier) {
+        auto iter = std::upper_bound(data->ownedAdjoints.begin(), data->ownedAdjoints.end(),
+                                     ToolInterface::AdjointRange(identifier, std::numeric_limits<std::size_t>::max()));
+        return iter != data->ownedAdjoints.begin() && identifier < std::prev(iter)->second;
+      }
+
+    public:
+
+      std::atomic<std::size_t> nParts;
+      std::atomic<std::size_t> nClassicalCandidates;  // parts that are not classical but could be
+      std::atomic<std::size_t> nViolations;  // parts whose mode or owned adjoints are not safe
+
+      OmpLogicAdjointAccessInstrument() : isSupported(true), nParts(0), nClassicalCandidates(0), nViolations(0) {}
+
+      virtual ~OmpLogicAdjointAccessInstrument() {}
+
+      virtual void reverseParallelBegin(ParallelData* data) {
+
+        if (!this->isSupported.load()) {
+          return;
+        }
+
+        assert(tool != nullptr);
+
+        // adjoint accesses per part, indexed by thread and part
+        std::vector<std::vector<Part>> parts(data->actualSizeOfTeam);
+
+        // thread that updates an adjoint, severalThreads if there is more than one
+        std::unordered_map<std::size_t, int> updatingThread;
+        std::unordered_map<std::size_t, int> privatizedUpdatingThread;  // only updates in privatized parts
+
+        for (int i = 0; i < data->actualSizeOfTeam; ++i) {
+          ImplicitTaskData* implicitTaskData = data->childTaskData[i];
+          parts[i].resize(implicitTaskData->positions.size());
+
+          for (std::size_t j = implicitTaskData->positions.size() - 1; j > 0; --j) {
+            Part& part = parts[i][j];
+            if (!tool->getAdjointAccesses(implicitTaskData->newTape, implicitTaskData->positions[j],
+                                          implicitTaskData->positions[j - 1], part.read, part.updated)) {
+              Output::print("adjoint access analysis is not supported by the AD tool");
+              this->isSupported.store(false);
+              return;
+            }
+
+            bool isPrivatized = (implicitTaskData->adjointAccessModes[j - 1] ==
+                                 LogicInterface::AdjointAccessMode::Privatized);
+
+            for (std::size_t identifier : part.updated) {
+              OmpLogicAdjointAccessInstrument::addUpdate(updatingThread, identifier, i);
+              if (isPrivatized) {
+                OmpLogicAdjointAccessInstrument::addUpdate(privatizedUpdatingThread, identifier, i);
+              }
+            }
+          }
+        }
+
+        for (int i = 0; i < data->actualSizeOfTeam; ++i) {
+          ImplicitTaskData* implicitTaskData = data->childTaskData[i];
+
+          for (std::size_t j = implicitTaskData->positions.size() - 1; j > 0; --j) {
+            Part& part = parts[i][j];
+            LogicInterface::AdjointAccessMode mode = implicitTaskData->adjointAccessModes[j - 1];
+
+            // such updates are buffered until the end of the parallel region
+            auto isPrivatizedUpdateOfOthers = [&](std::size_t identifier) {
+              auto iter = privatizedUpdatingThread.find(identifier);
+              return iter != privatizedUpdatingThread.end() && iter->second != i;
+            };
+
+            auto isSharedUpdate = [&](std::size_t identifier) {
+              return updatingThread.at(identifier) == severalThreads;
+            };
+
+            bool hasSharedUpdates = std::any_of(part.updated.begin(), part.updated.end(), isSharedUpdate);
+
+            bool isValid = true;
+
+            if (mode == LogicInterface::AdjointAccessMode::Classical && hasSharedUpdates) {
+              Output::print("R AACC l", implicitTaskData->level, "t", i, "part", j, "mode", mode,
+                            "(shared adjoint updates, classical mode is not safe)");
+              isValid = false;
+            }
+
+            if (std::any_of(part.read.begin(), part.read.end(), isPrivatizedUpdateOfOthers)) {
+              Output::print("R AACC l", implicitTaskData->level, "t", i, "part", j, "mode", mode,
+                            "(reads adjoints that other threads update in privatized mode)");
+              isValid = false;
+            }
+
+            if (mode != LogicInterface::AdjointAccessMode::Classical &&
+                std::any_of(part.updated.begin(), part.updated.end(), [&](std::size_t identifier) {
+                  return isSharedUpdate(identifier) && isOwned(implicitTaskData, identifier);
+                })) {
+              Output::print("R AACC l", implicitTaskData->level, "t", i, "part", j, "mode", mode,
+                            "(owned adjoints are updated by other threads)");
+              isValid = false;
+            }
+
+            if (mode != LogicInterface::AdjointAccessMode::Classical && !hasSharedUpdates) {
+              Output::print("R AACC l", implicitTaskData->level, "t", i, "part", j, "mode", mode,
+                            "(no shared adjoint updates, classical mode is possible)");
+              ++this->nClassicalCandidates;
+            }
+
+            ++this->nParts;
+            this->nViolations += !isValid;
+          }
+        }
+      }
+  };
+}
@@ -64,6 +64,7 @@ namespace opdi {
 
       virtual void reverseParallelBegin(ParallelData* /*data*/) {}
       virtual void reverseParallelEnd(ParallelData* /*data*/) {}
+      virtual void reverseParallelSerial(ParallelData* /*data*/) {}
       virtual void reverseImplicitTaskBegin(ImplicitTaskData* /*data*/) {}
       virtual void reverseImplicitTaskEnd(ImplicitTaskData* /*data*/) {}
       virtual void reverseImplicitTaskPart(ImplicitTaskData* /*data*/, std::size_t /*part*/) {}
@@ -82,6 +83,8 @@ namespace opdi {
       /* instrumentation of other functionality */
 
       virtual void onSetAdjointAccessMode(LogicInterface::AdjointAccessMode /*adjointAccess*/) {}
+
+      virtual void onAddOwnedAdjoints(std::size_t /*begin*/, std::size_t /*end*/) {}
   };
 
   extern std::list<OmpLogicInstrumentInterface*> ompLogicInstruments;
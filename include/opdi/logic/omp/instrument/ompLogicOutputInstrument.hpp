@@ -154,6 +154,12 @@ namespace opdi {
                            "parent", data->encounteringTaskTape);
       }
 
+      virtual void reverseParallelSerial(ParallelData* data) {
+        TapedOutput::print("R PARS l", omp_get_level(),
+                           "t", omp_get_thread_num(),
+                           "parent", data->encounteringTaskTape);
+      }
+
       virtual void reverseImplicitTaskBegin(ImplicitTaskData* data) {
         assert(tool != nullptr);
         TapedOutput::print("R IMTB l", data->level,
@@ -216,5 +222,9 @@ namespace opdi {
       virtual void onSetAdjointAccessMode(LogicInterface::AdjointAccessMode adjointAccess) {
         TapedOutput::print("F SAAM t", omp_get_thread_num(), "mode", adjointAccess);
       }
+
+      virtual void onAddOwnedAdjoints(std::size_t begin, std::size_t end) {
+        TapedOutput::print("F AOWN t", omp_get_thread_num(), "begin", begin, "end", end);
+      }
   };
 }
@@ -27,11 +27,12 @@
 
 #include "../../helpers/macros.hpp"
 #include "../../config.hpp"
-#include "../../tool/toolInterface.hpp"
+#include "../../tool/boundTool.hpp"
 
 #include "instrument/ompLogicInstrumentInterface.hpp"
 
 #include "maskedOmpLogic.hpp"
+#include "recordingState.hpp"
 
 void opdi::MaskedOmpLogic::reverseFunc(void *dataPtr) {
 
@@ -45,29 +46,22 @@ void opdi::MaskedOmpLogic::reverseFunc(void *dataPtr) {
   #endif
 }
 
-void opdi::MaskedOmpLogic::deleteFunc(void* dataPtr) {
-
-  Data* data = static_cast<Data*>(dataPtr);
-  delete data;
-}
-
 void opdi::MaskedOmpLogic::onMasked(ScopeEndpoint endpoint) {
 
   #if OPDI_OMP_LOGIC_INSTRUMENT
-    if (tool != nullptr && tool->getThreadLocalTape() != nullptr && tool->isActive(tool->getThreadLocalTape())) {
+    if (RecordingState::isRecording()) {
 
-      Data* data = new Data;
-      data->endpoint = endpoint;
+      Data data;
+      data.endpoint = endpoint;
 
       for (auto& instrument : ompLogicInstruments) {
-        instrument->onMasked(data);
+        instrument->onMasked(&data);
       }
 
-      Handle* handle = new Handle;
-      handle->data = static_cast<void*>(data);
-      handle->reverseFunc = MaskedOmpLogic::reverseFunc;
-      handle->deleteFunc = MaskedOmpLogic::deleteFunc;
-      tool->pushExternalFunction(tool->getThreadLocalTape(), handle);
+      InlineHandle handle;
+      handle.setData(data);
+      handle.reverseFunc = MaskedOmpLogic::reverseFunc;
+      boundTool()->pushInlineExternalFunction(boundTool()->getThreadLocalTape(), handle);
     }
   #else
     OPDI_UNUSED(endpoint);
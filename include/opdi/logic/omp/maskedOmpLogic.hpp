@@ -41,7 +41,6 @@ namespace opdi {
     private:
 
       static void reverseFunc(void* dataPtr);
-      static void deleteFunc(void* dataPtr);
 
     public:
 
@@ -29,16 +29,20 @@
 #include "../../helpers/macros.hpp"
 #include "../../helpers/tsanDefinitions.hpp"
 #include "../../config.hpp"
-#include "../../tool/toolInterface.hpp"
+#include "../../misc/waitPolicy.hpp"
+#include "../../tool/boundTool.hpp"
 
 #include "instrument/ompLogicInstrumentInterface.hpp"
 
 #include "mutexOmpLogic.hpp"
+#include "recordingState.hpp"
 
-opdi::MutexOmpLogic::AllCounters opdi::MutexOmpLogic::localCounters;
-opdi::MutexOmpLogic::AllCounters opdi::MutexOmpLogic::evaluationCounters;
+std::array<opdi::MutexOmpLogic::CounterCache, opdi::MutexOmpLogic::nMutexKind> opdi::MutexOmpLogic::counterCaches;
+std::size_t opdi::MutexOmpLogic::localCacheGeneration = 0;
+std::size_t opdi::MutexOmpLogic::cacheGeneration = 0;
+opdi::MutexOmpLogic::AllEvaluationCounters opdi::MutexOmpLogic::evaluationCounters;
 #ifdef __SANITIZE_THREAD__
-  opdi::MutexOmpLogic::AllCounters opdi::MutexOmpLogic::tsanDummies;
+  opdi::MutexOmpLogic::AllEvaluationCounters opdi::MutexOmpLogic::tsanDummies;
 #endif
 
 void opdi::MutexOmpLogic::checkKind(MutexKind mutexKind) {
@@ -47,6 +51,34 @@ void opdi::MutexOmpLogic::checkKind(MutexKind mutexKind) {
   }
 }
 
+opdi::MutexOmpLogic::CounterCache& opdi::MutexOmpLogic::getCounterCache(MutexKind mutexKind) {
+
+  // drop cached counters if they might refer to outdated recordings
+  if (MutexOmpLogic::localCacheGeneration != MutexOmpLogic::cacheGeneration) {
+    for (auto& counterCache : MutexOmpLogic::counterCaches) {
+      counterCache.clear();
+    }
+    MutexOmpLogic::localCacheGeneration = MutexOmpLogic::cacheGeneration;
+  }
+
+  return MutexOmpLogic::counterCaches[mutexKind];
+}
+
+// the lock is only required to look up or insert the slot in the recording
+opdi::MutexOmpLogic::Slot* opdi::MutexOmpLogic::getSlot(MutexKind mutexKind, WaitId waitId) {
+  omp_set_lock(&this->recordings[mutexKind].lock);
+  Counters& counters = this->recordings[mutexKind].counters;
+  auto iter = counters.find(waitId);
+  if (iter == counters.end()) {
+    // slots are never removed individually, hence indices are dense
+    iter = counters.emplace(waitId, Slot{0, counters.size()}).first;
+  }
+  Slot* slot = &iter->second;
+  omp_unset_lock(&this->recordings[mutexKind].lock);
+
+  return slot;
+}
+
 void opdi::MutexOmpLogic::waitReverseFunc(void* dataPtr) {
 
   Data* data = static_cast<Data*>(dataPtr);
@@ -57,20 +89,20 @@ void opdi::MutexOmpLogic::waitReverseFunc(void* dataPtr) {
     }
   #endif
 
-  // busy wait until counter is matched
-  while (true) {
-    MutexOmpLogic::Counter currentValue;
+  Counter& counter = MutexOmpLogic::evaluationCounters[data->mutexKind][data->index].value;
+
+  // wait until counter is matched
+  WaitPolicy::wait<OPDI_REVERSE_MUTEX_WAIT_POLICY>(&counter, [&]() {
+    Counter currentValue;
 
     #pragma omp atomic read
-    currentValue = MutexOmpLogic::evaluationCounters[data->mutexKind][data->waitId];
+    currentValue = counter;
 
-    if (currentValue == data->counter) {
-      break;
-    }
-  }
+    return currentValue == data->counter;
+  });
 
   #ifdef __SANITIZE_THREAD__
-    ANNOTATE_RWLOCK_ACQUIRED(&MutexOmpLogic::tsanDummies[data->mutexKind][data->waitId], true);
+    ANNOTATE_RWLOCK_ACQUIRED(&MutexOmpLogic::tsanDummies[data->mutexKind][data->index], true);
   #endif
 }
 
@@ -79,23 +111,28 @@ void opdi::MutexOmpLogic::decrementReverseFunc(void* dataPtr) {
   Data* data = static_cast<Data*>(dataPtr);
 
   #ifdef __SANITIZE_THREAD__
-    ANNOTATE_RWLOCK_RELEASED(&MutexOmpLogic::tsanDummies[data->mutexKind][data->waitId], true);
+    ANNOTATE_RWLOCK_RELEASED(&MutexOmpLogic::tsanDummies[data->mutexKind][data->index], true);
   #endif
 
+  Counter& counter = MutexOmpLogic::evaluationCounters[data->mutexKind][data->index].value;
+
   // decrement counter
   #ifdef NDEBUG
     #pragma omp atomic update
-    MutexOmpLogic::evaluationCounters[data->mutexKind][data->waitId] -= 1;
+    counter -= 1;
   #else
     Counter newValue;
     #pragma omp atomic capture
     {
-      MutexOmpLogic::evaluationCounters[data->mutexKind][data->waitId] -= 1;
-      newValue = MutexOmpLogic::evaluationCounters[data->mutexKind][data->waitId];
+      counter -= 1;
+      newValue = counter;
     }
     assert(newValue == data->counter);
   #endif
 
+  // wake threads that wait for this counter
+  WaitPolicy::notify<OPDI_REVERSE_MUTEX_WAIT_POLICY>(&counter);
+
   #if OPDI_OMP_LOGIC_INSTRUMENT
     for (auto& instrument : ompLogicInstruments) {
       instrument->reverseMutexDecrement(data);
@@ -103,16 +140,14 @@ void opdi::MutexOmpLogic::decrementReverseFunc(void* dataPtr) {
   #endif
 }
 
-void opdi::MutexOmpLogic::deleteFunc(void* dataPtr) {
-  Data* data = static_cast<Data*>(dataPtr);
-  delete data;
-}
-
 void opdi::MutexOmpLogic::internalInit() {
   for (std::size_t mutexKind = 0; mutexKind < nMutexKind; ++mutexKind) {
     omp_init_lock(&this->recordings[mutexKind].lock);
     this->recordings[mutexKind].waitId = backend->getLockIdentifier(&this->recordings[mutexKind].lock);
   }
+
+  // counters cached for a previous logic instance must not be used
+  ++MutexOmpLogic::cacheGeneration;
 }
 
 void opdi::MutexOmpLogic::internalFinalize() {
@@ -124,7 +159,7 @@ void opdi::MutexOmpLogic::internalFinalize() {
 void opdi::MutexOmpLogic::onMutexDestroyed(MutexKind mutexKind, WaitId waitId) {
 
   #if OPDI_OMP_LOGIC_INSTRUMENT
-    Data data = {mutexKind, waitId, 0};
+    Data data = {mutexKind, 0, waitId, 0};
     for (auto& instrument : ompLogicInstruments) {
       instrument->onMutexDestroyed(&data);
     }
@@ -147,33 +182,48 @@ void opdi::MutexOmpLogic::onMutexAcquired(MutexKind mutexKind, WaitId waitId) {
     }
   }
 
-  if (tool != nullptr && tool->getThreadLocalTape() != nullptr && tool->isActive(tool->getThreadLocalTape())) {
+  if (RecordingState::isRecording()) {
 
     // skip inactive mutexes
     if (recordings[mutexKind].inactive.count(waitId) == 0) {
 
-      Data* data = new Data;
-      data->mutexKind = mutexKind;
-      data->waitId = waitId;
+      CachedCounter& cachedCounter = MutexOmpLogic::getCounterCache(mutexKind)[waitId];
+
+      // the release event is skipped as well
+      cachedCounter.pending = true;
+      cachedCounter.skipped = RecordingState::skipsReverseSynchronization();
+      if (cachedCounter.skipped) {
+        return;
+      }
+
+      Data data;
+      data.mutexKind = mutexKind;
+      data.waitId = waitId;
+
+      if (cachedCounter.slot == nullptr) {
+        cachedCounter.slot = this->getSlot(mutexKind, waitId);
+      }
+
+      data.index = cachedCounter.slot->index;
+
+      #pragma omp atomic capture
+      data.counter = cachedCounter.slot->counter++;  // store value prior to increment
 
-      omp_set_lock(&recordings[mutexKind].lock);
-      data->counter = recordings[mutexKind].counters[waitId]++;  // store value prior to increment
-      localCounters[mutexKind][waitId] = recordings[mutexKind].counters[waitId];  // remember incremented counter value for the release event
-      omp_unset_lock(&recordings[mutexKind].lock);
+      cachedCounter.local = data.counter + 1;  // remember incremented counter value for the release event
 
       #if OPDI_OMP_LOGIC_INSTRUMENT
         for (auto& instrument : ompLogicInstruments) {
-          instrument->onMutexAcquired(data);
+          instrument->onMutexAcquired(&data);
         }
       #endif
 
       // push decrement handle
-      Handle* handle = new Handle;
-      handle->data = static_cast<void*>(data);
-      handle->reverseFunc = MutexOmpLogic::decrementReverseFunc;
-      handle->deleteFunc = MutexOmpLogic::deleteFunc;
+      InlineHandle handle;
+      handle.setData(data);
+      handle.reverseFunc = MutexOmpLogic::decrementReverseFunc;
 
-      tool->pushExternalFunction(tool->getThreadLocalTape(), handle);
+      boundTool()->pushInlineExternalFunction(boundTool()->getThreadLocalTape(), handle);
+      ++RecordingState::nSynchronizingHandles;
     }
   }
 }
@@ -191,30 +241,51 @@ void opdi::MutexOmpLogic::onMutexReleased(MutexKind mutexKind, WaitId waitId) {
     }
   }
 
-  if (tool != nullptr && tool->getThreadLocalTape() != nullptr && tool->isActive(tool->getThreadLocalTape())) {
+  if (RecordingState::isRecording()) {
 
     // skip inactive mutexes
     if (recordings[mutexKind].inactive.count(waitId) == 0) {
 
-      Data* data = new Data;
-      data->mutexKind = mutexKind;
-      data->waitId = waitId;
+      CounterCache& counterCache = MutexOmpLogic::getCounterCache(mutexKind);
+      auto iter = counterCache.find(waitId);
 
-      data->counter = localCounters[mutexKind][waitId];
+      Data data;
+      data.mutexKind = mutexKind;
+      data.waitId = waitId;
+
+      if (iter != counterCache.end() && iter->second.pending) {
+        iter->second.pending = false;
+        if (iter->second.skipped) {
+          return;
+        }
+
+        data.counter = iter->second.local;
+        data.index = iter->second.slot->index;
+      }
+      else {
+        // the acquire event was not recorded, e.g., recording was started inside a critical region
+        // wait until the acquisitions recorded after this one have been reverted, which is the current counter as the
+        // mutex is still held, or 0 if recording has just started
+        Slot* slot = this->getSlot(mutexKind, waitId);
+        data.index = slot->index;
+
+        #pragma omp atomic read
+        data.counter = slot->counter;
+      }
 
       #if OPDI_OMP_LOGIC_INSTRUMENT
         for (auto& instrument : ompLogicInstruments) {
-          instrument->onMutexReleased(data);
+          instrument->onMutexReleased(&data);
         }
       #endif
 
       // push wait handle
-      Handle* handle = new Handle;
-      handle->data = static_cast<void*>(data);
-      handle->reverseFunc = MutexOmpLogic::waitReverseFunc;
-      handle->deleteFunc = MutexOmpLogic::deleteFunc;
+      InlineHandle handle;
+      handle.setData(data);
+      handle.reverseFunc = MutexOmpLogic::waitReverseFunc;
 
-      tool->pushExternalFunction(tool->getThreadLocalTape(), handle);
+      boundTool()->pushInlineExternalFunction(boundTool()->getThreadLocalTape(), handle);
+      ++RecordingState::nSynchronizingHandles;
     }
   }
 }
@@ -228,7 +299,11 @@ void opdi::MutexOmpLogic::registerInactiveMutex(MutexKind mutexKind, WaitId wait
 // not thread-safe! only use outside of parallel regions
 void opdi::MutexOmpLogic::prepareEvaluate() {
   for (std::size_t mutexKind = 0; mutexKind < nMutexKind; ++mutexKind) {
-    MutexOmpLogic::evaluationCounters[mutexKind] = this->recordings[mutexKind].counters;
+    Counters const& counters = this->recordings[mutexKind].counters;
+    MutexOmpLogic::evaluationCounters[mutexKind].resize(counters.size());
+    for (auto const& pair : counters) {
+      MutexOmpLogic::evaluationCounters[mutexKind][pair.second.index].value = pair.second.counter;
+    }
   }
 
 #ifdef __SANITIZE_THREAD__
@@ -236,12 +311,10 @@ void opdi::MutexOmpLogic::prepareEvaluate() {
 
   for (std::size_t mutexKind = 0; mutexKind < nMutexKind; ++mutexKind) {
     assert(tsanDummies[mutexKind].empty());
-    for (auto const& pair : evaluationCounters[mutexKind]) {
-      tsanDummies[mutexKind][pair.first] = 0;
-    }
+    tsanDummies[mutexKind].resize(evaluationCounters[mutexKind].size());
 
-    for (auto& pair : tsanDummies[mutexKind]) {
-      ANNOTATE_RWLOCK_CREATE(&pair.second);
+    for (auto& dummy : tsanDummies[mutexKind]) {
+      ANNOTATE_RWLOCK_CREATE(&dummy);
     }
   }
 #endif
@@ -253,8 +326,8 @@ void opdi::MutexOmpLogic::postEvaluate() {
   /* destroy lock annotations */
 
   for (std::size_t mutexKind = 0; mutexKind < nMutexKind; ++mutexKind) {
-    for (auto& pair : tsanDummies[mutexKind]) {
-      ANNOTATE_RWLOCK_DESTROY(&pair.second);
+    for (auto& dummy : tsanDummies[mutexKind]) {
+      ANNOTATE_RWLOCK_DESTROY(&dummy);
     }
 
     tsanDummies[mutexKind].clear();
@@ -267,6 +340,8 @@ void opdi::MutexOmpLogic::reset() {
   for (std::size_t mutexKind = 0; mutexKind < nMutexKind; ++mutexKind) {
     this->recordings[mutexKind].counters.clear();
   }
+
+  ++MutexOmpLogic::cacheGeneration;
 }
 
 // not thread-safe! only use outside of parallel regions
@@ -289,4 +364,6 @@ void opdi::MutexOmpLogic::recoverState(void* statePtr) {
   for (std::size_t mutexKind = 0; mutexKind < nMutexKind; ++mutexKind) {
     this->recordings[mutexKind].counters = (*state)[mutexKind];
   }
+
+  ++MutexOmpLogic::cacheGeneration;
 }
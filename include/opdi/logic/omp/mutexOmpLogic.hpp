@@ -29,6 +29,9 @@
 #include <map>
 #include <omp.h>
 #include <set>
+#include <unordered_map>
+#include <vector>
+
 
 #include "../logicInterface.hpp"
 
@@ -45,8 +48,15 @@ namespace opdi {
 
     private:
 
-      // for one kind of mutex, associates corresponding wait ids with counters
-      using Counters = std::map<WaitId, Counter>;
+      // recorded counter of a mutex, together with the mutex' dense index among all mutexes of the same kind
+      struct Slot {
+        public:
+          Counter counter;
+          std::size_t index;
+      };
+
+      // for one kind of mutex, associates corresponding wait ids with slots
+      using Counters = std::map<WaitId, Slot>;
 
       // for one kind of mutex, facilities for recording corresponding mutexes
       struct Recording {
@@ -59,17 +69,42 @@ namespace opdi {
 
       std::array<Recording, nMutexKind> recordings;  // recordings for all mutex kinds
 
+      // thread-local reference to a recorded counter
+      struct CachedCounter {
+        public:
+          Slot* slot;  // points into the recording's counters, stable until they are cleared or replaced
+          Counter local;  // data exchange between acquire and release events
+          bool skipped;  // whether the acquire event was recorded without reverse synchronization
+          bool pending;  // whether a recorded acquire event awaits its release event
+      };
+
+      // for one kind of mutex, associates corresponding wait ids with cached counters
+      using CounterCache = std::unordered_map<WaitId, CachedCounter>;
+
+      // thread-local memory used during recording, the internal lock is only required if a wait id is not cached yet
+      static std::array<CounterCache, nMutexKind> counterCaches;
+      static std::size_t localCacheGeneration;
+      #pragma omp threadprivate(counterCaches, localCacheGeneration)
+
+      // changing the generation invalidates the counter caches of all threads
+      static std::size_t cacheGeneration;
+
       // counters for all mutex kinds
       using AllCounters = std::array<Counters, nMutexKind>;
 
-      // thread-local memory used during recording for data exchange between acquire and release events
-      static AllCounters localCounters;
-      #pragma omp threadprivate(localCounters)
+      // counter used during evaluations, padded to avoid false sharing between different mutexes
+      struct alignas(64) EvaluationCounter {
+        public:
+          Counter value;
+      };
+
+      // for all mutex kinds, evaluation counters addressed by the slot indices
+      using AllEvaluationCounters = std::array<std::vector<EvaluationCounter>, nMutexKind>;
 
       // counters used during evaluations
-      static AllCounters evaluationCounters;
+      static AllEvaluationCounters evaluationCounters;
 #ifdef __SANITIZE_THREAD__
-      static AllCounters tsanDummies;
+      static AllEvaluationCounters tsanDummies;
 #endif
 
       // currently, OpDiLib's internal state corresponds to the values of all mutex counters
@@ -82,15 +117,19 @@ namespace opdi {
           MutexKind mutexKind;
           Counter counter;
           WaitId waitId;
+          std::size_t index;  // slot index of the mutex, used to access evaluation counters
       };
 
     private:
 
       void checkKind(MutexKind mutexKind);
 
+      static CounterCache& getCounterCache(MutexKind mutexKind);
+
+      Slot* getSlot(MutexKind mutexKind, WaitId waitId);
+
       static void waitReverseFunc(void* dataPtr);
       static void decrementReverseFunc(void* dataPtr);
-      static void deleteFunc(void* dataPtr);
 
     protected:
 
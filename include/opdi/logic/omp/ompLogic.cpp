@@ -31,15 +31,20 @@
 #elif OPDI_DEFAULT_ADJOINT_ACCESS_MODE == OPDI_ADJOINT_ACCESS_CLASSICAL
   opdi::LogicInterface::AdjointAccessMode const opdi::ImplicitTaskOmpLogic::defaultAdjointAccessMode
       = opdi::LogicInterface::AdjointAccessMode::Classical;
+#elif OPDI_DEFAULT_ADJOINT_ACCESS_MODE == OPDI_ADJOINT_ACCESS_PRIVATIZED
+  opdi::LogicInterface::AdjointAccessMode const opdi::ImplicitTaskOmpLogic::defaultAdjointAccessMode
+      = opdi::LogicInterface::AdjointAccessMode::Privatized;
 #else
   #error Unknown adjoint access mode.
 #endif
 
 std::list<opdi::OmpLogicInstrumentInterface*> opdi::ompLogicInstruments;
 
+#include "flushOmpLogic.cpp"
 #include "implicitTaskOmpLogic.cpp"
 #include "maskedOmpLogic.cpp"
 #include "mutexOmpLogic.cpp"
 #include "parallelOmpLogic.cpp"
+#include "recordingState.cpp"
 #include "syncRegionOmpLogic.cpp"
 #include "workOmpLogic.cpp"
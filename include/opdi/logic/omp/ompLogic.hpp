@@ -28,6 +28,7 @@
 #include <cassert>
 
 #include "../../backend/backendInterface.hpp"
+#include "../../misc/reverseTeam.hpp"
 #include "../../misc/tapedOutput.hpp"
 
 #include "../logicInterface.hpp"
@@ -60,10 +61,10 @@ namespace opdi {
         assert(backend != nullptr);
 
         MutexOmpLogic::internalInit();
-        ImplicitTaskOmpLogic::internalInit();
+        ParallelOmpLogic::internalInit();
 
         // this is important to avoid deadlocks with the ompt backend
-        MutexOmpLogic::registerInactiveMutex(MutexKind::Lock, backend->getLockIdentifier(ImplicitTaskOmpLogic::tapePool.getInternalLock()));
+        MutexOmpLogic::registerInactiveMutex(MutexKind::Lock, backend->getLockIdentifier(ParallelOmpLogic::tapePool.getInternalLock()));
 
         TapedOutput::init();
         MutexOmpLogic::registerInactiveMutex(MutexKind::Lock, backend->getLockIdentifier(&(TapedOutput::lock)));
@@ -84,16 +85,46 @@ namespace opdi {
         onImplicitTaskEnd(static_cast<void*>(initialImplicitTaskData));
 
         MutexOmpLogic::internalFinalize();
-        ImplicitTaskOmpLogic::internalFinalize();
+        ParallelOmpLogic::internalFinalize();
         TapedOutput::finalize();
+
+        #if OPDI_PERSISTENT_REVERSE_TEAM
+          ReverseTeam::finalize();
+        #endif
+
+        // no effect if there are remaining recordings
+        BlockPool::release();
       }
 
       virtual void prepareEvaluate() {
         MutexOmpLogic::prepareEvaluate();
+
+        #if OPDI_PERSISTENT_REVERSE_TEAM
+          ReverseTeam::beginEvaluation();
+        #endif
+      }
+
+      virtual void postEvaluate() {
+        #if OPDI_PERSISTENT_REVERSE_TEAM
+          ReverseTeam::endEvaluation();
+        #endif
+
+        MutexOmpLogic::postEvaluate();
+      }
+
+      virtual void recoverState(void* state) {
+        ParallelOmpLogic::internalCompleteCleanup();
+        MutexOmpLogic::recoverState(state);
       }
 
       virtual void reset() {
+        ParallelOmpLogic::internalCompleteCleanup();
         MutexOmpLogic::reset();
+
+        #if !OPDI_BLOCK_POOL_REUSE_MEMORY
+          // no effect if other tapes still hold AD events
+          BlockPool::release();
+        #endif
       }
   };
 }
@@ -23,78 +23,375 @@
  *
  */
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <omp.h>
+#include <unordered_map>
 
 #include "../../backend/backendInterface.hpp"
 #include "../../config.hpp"
-#include "../../tool/toolInterface.hpp"
+#include "../../misc/elasticTeam.hpp"
+#include "../../misc/reverseTeam.hpp"
+#include "../../misc/waitPolicy.hpp"
+#include "../../tool/boundTool.hpp"
 
 #include "instrument/ompLogicInstrumentInterface.hpp"
 
 #include "implicitTaskOmpLogic.hpp"
 #include "parallelOmpLogic.hpp"
+#include "recordingState.hpp"
+#include "workOmpLogic.hpp"
 
 int opdi::ParallelOmpLogic::skipParallelRegion = 0;
+std::vector<opdi::ParallelData*> opdi::ParallelOmpLogic::pendingCleanup;
 
-void opdi::ParallelOmpLogic::reverseFunc(void* parallelDataPtr) {
+void opdi::ParallelOmpLogic::internalInit() {
+  this->tapePool.init();
+}
 
-  assert(tool != nullptr);
+void opdi::ParallelOmpLogic::internalFinalize() {
+  ParallelOmpLogic::internalCompleteCleanup();
+
+  this->tapePool.finalize();
+
+  RecyclingPool<ParallelData>::clear();
+  RecyclingPool<ImplicitTaskData>::clear();
+  RecyclingPool<ReverseBarrier>::clear();
+  RecyclingPool<AdjointBuffers>::clear();
+
+  #if OPDI_ELASTIC_REVERSE_TEAM
+    ElasticTeam::clear();
+  #endif
+}
+
+void opdi::ParallelOmpLogic::reverseImplicitTask(void* parallelDataPtr, int threadNum) {
 
   ParallelData* parallelData = static_cast<ParallelData*>(parallelDataPtr);
 
+  ImplicitTaskData* implicitTaskData = parallelData->childTaskData[threadNum];
+
+  assert(implicitTaskData->indexInTeam == threadNum);
+
   #if OPDI_OMP_LOGIC_INSTRUMENT
     for (auto& instrument : ompLogicInstruments) {
-      instrument->reverseParallelBegin(parallelData);
+      instrument->reverseImplicitTaskBegin(implicitTaskData);
     }
   #endif
 
-  ParallelOmpLogic::internalBeginSkippedParallelRegion();
+  #if OPDI_REVERSE_BARRIER != OPDI_REVERSE_BARRIER_OMP
+    ReverseBarrier::Member previousMember = ReverseBarrier::enter(parallelData->reverseBarrier, threadNum);
+  #elif OPDI_ELASTIC_REVERSE_TEAM
+    // logical threads that share a thread cannot meet in barriers of the OpenMP runtime
+    ReverseBarrier::Member previousMember = ReverseBarrier::enter(
+        ElasticTeam::isRunning() ? parallelData->reverseBarrier : nullptr, threadNum);
+  #endif
 
-  #pragma omp parallel num_threads(parallelData->actualSizeOfTeam)
-  {
-    if (parallelData->actualSizeOfTeam != omp_get_num_threads()) {
-      OPDI_ERROR("Parallel region in the reverse pass does not use the required number of threads.");
-    }
+  void* oldTape = boundTool()->getThreadLocalTape();
+  boundTool()->setThreadLocalTape(implicitTaskData->newTape);
+  // since the tapes are already set passive when forward implicit tasks finish, there is no need to do that here
+
+  void* oldAdjointBuffer = AdjointBuffers::getActiveBuffer();
+  AdjointBuffers::setActiveBuffer(nullptr);
 
-    int threadNum = omp_get_thread_num();
+  #if OPDI_REVERSE_LOOP_WORK_STEALING
+    std::size_t nLoops = implicitTaskData->loops.size();
+    bool isLoopWorkStealingEnabled = !parallelData->isLoopWorkStealingDisabled.load();
+  #endif
 
-    ImplicitTaskData* implicitTaskData = parallelData->childTaskData[threadNum];
+  // privatized parts are evaluated like atomic ones if there are no buffers
+  auto getEvaluationMode = [parallelData](AdjointAccessMode mode) {
+    if (mode == AdjointAccessMode::Privatized && parallelData->adjointBuffers == nullptr) {
+      return AdjointAccessMode::Atomic;
+    }
+    return mode;
+  };
+
+  // earlier parts read adjoints from the global adjoints, so buffered updates of later parts have to be merged first
+  bool hasBufferedUpdates = false;
+  auto mergeBufferedUpdates = [parallelData, threadNum, &hasBufferedUpdates]() {
+    if (hasBufferedUpdates) {
+      void* adjointBuffer = (*parallelData->adjointBuffers)[threadNum];
+      boundTool()->mergeAdjointBuffers(&adjointBuffer, 1, 0, 1, true);
+      hasBufferedUpdates = false;
+    }
+  };
 
-    assert(implicitTaskData->indexInTeam == threadNum);
+  std::size_t j = implicitTaskData->positions.size() - 1;
+  while (j > 0) {
 
     #if OPDI_OMP_LOGIC_INSTRUMENT
       for (auto& instrument : ompLogicInstruments) {
-        instrument->reverseImplicitTaskBegin(implicitTaskData);
+        instrument->reverseImplicitTaskPart(implicitTaskData, j);
       }
     #endif
 
-    void* oldTape = tool->getThreadLocalTape();
-    tool->setThreadLocalTape(implicitTaskData->newTape);
-    // since the tapes are already set passive when forward implicit tasks finish, there is no need to do that here
+    // parts up to this one may be evaluated together
+    std::size_t lastPart = 0;
+
+    #if OPDI_REVERSE_LOOP_WORK_STEALING
+      // skip loops that end later or do not form a part on their own
+      while (nLoops != 0 && (implicitTaskData->loops[nLoops - 1].part > j ||
+                             (implicitTaskData->loops[nLoops - 1].part == j &&
+                              !implicitTaskData->loops[nLoops - 1].isStealable))) {
+        --nLoops;
+      }
+
+      if (nLoops != 0 && implicitTaskData->loops[nLoops - 1].part == j && isLoopWorkStealingEnabled) {
+        --nLoops;
+        mergeBufferedUpdates();
+        WorkOmpLogic::reverseLoop(parallelData, threadNum, nLoops);
+        --j;
+        continue;
+      }
+
+      if (nLoops != 0 && isLoopWorkStealingEnabled) {
+        lastPart = implicitTaskData->loops[nLoops - 1].part;
+      }
+    #endif
 
-    for (size_t j = implicitTaskData->positions.size() - 1; j > 0; --j) {
+    AdjointAccessMode mode = getEvaluationMode(implicitTaskData->adjointAccessModes[j - 1]);
 
+    // adjacent parts that are evaluated alike are evaluated in a single call
+    std::size_t k = j - 1;
+    while (k > lastPart && getEvaluationMode(implicitTaskData->adjointAccessModes[k - 1]) == mode) {
       #if OPDI_OMP_LOGIC_INSTRUMENT
         for (auto& instrument : ompLogicInstruments) {
-          instrument->reverseImplicitTaskPart(implicitTaskData, j);
+          instrument->reverseImplicitTaskPart(implicitTaskData, k);
         }
       #endif
+      --k;
+    }
 
-      tool->evaluate(implicitTaskData->newTape,
+    if (mode == AdjointAccessMode::Privatized) {
+      void* adjointBuffer = (*parallelData->adjointBuffers)[threadNum];
+      AdjointBuffers::setActiveBuffer(adjointBuffer);
+
+      boundTool()->evaluatePrivatized(implicitTaskData->newTape,
+                                      implicitTaskData->positions[j],
+                                      implicitTaskData->positions[k],
+                                      adjointBuffer);
+
+      AdjointBuffers::setActiveBuffer(nullptr);
+      hasBufferedUpdates = true;
+    }
+    else if (mode == AdjointAccessMode::Atomic && !implicitTaskData->ownedAdjoints.empty()) {
+      mergeBufferedUpdates();
+      boundTool()->evaluateOwned(implicitTaskData->newTape,
+                                 implicitTaskData->positions[j],
+                                 implicitTaskData->positions[k],
+                                 implicitTaskData->ownedAdjoints.data(),
+                                 implicitTaskData->ownedAdjoints.size());
+    }
+    else {
+      mergeBufferedUpdates();
+      boundTool()->evaluate(implicitTaskData->newTape,
                      implicitTaskData->positions[j],
-                     implicitTaskData->positions[j - 1],
-                     implicitTaskData->adjointAccessModes[j - 1] == AdjointAccessMode::Atomic);
+                     implicitTaskData->positions[k],
+                     mode == AdjointAccessMode::Atomic);
+    }
+
+    j = k;
+  }
+
+  AdjointBuffers::setActiveBuffer(oldAdjointBuffer);
+
+  boundTool()->setThreadLocalTape(oldTape);
+
+  #if OPDI_REVERSE_BARRIER != OPDI_REVERSE_BARRIER_OMP || OPDI_ELASTIC_REVERSE_TEAM
+    ReverseBarrier::leave(previousMember);
+  #endif
+
+  #if OPDI_OMP_LOGIC_INSTRUMENT
+    for (auto& instrument : ompLogicInstruments) {
+      instrument->reverseImplicitTaskEnd(implicitTaskData);
+    }
+  #endif
+}
+
+void opdi::ParallelOmpLogic::reverseImplicitTaskAndMerge(void* parallelDataPtr, int threadNum) {
+
+  ParallelOmpLogic::reverseImplicitTask(parallelDataPtr, threadNum);
+
+  ParallelData* parallelData = static_cast<ParallelData*>(parallelDataPtr);
+
+  if (parallelData->adjointBuffers != nullptr) {
+
+    // buffers can only be merged once all implicit tasks have completed their updates
+    if (parallelData->nEvaluated.fetch_add(1) + 1 == parallelData->actualSizeOfTeam) {
+      WaitPolicy::notify<OPDI_REVERSE_BARRIER_WAIT_POLICY>(&parallelData->nEvaluated);
+    }
+    else {
+      WaitPolicy::wait<OPDI_REVERSE_BARRIER_WAIT_POLICY>(&parallelData->nEvaluated, [parallelData]() {
+        return parallelData->nEvaluated.load() == parallelData->actualSizeOfTeam;
+      });
+    }
+
+    // each implicit task merges a share of the adjoints from all buffers
+    boundTool()->mergeAdjointBuffers(parallelData->adjointBuffers->data(), parallelData->actualSizeOfTeam,
+                                     threadNum, parallelData->actualSizeOfTeam, parallelData->isNestedEvaluation);
+  }
+}
+
+bool opdi::ParallelOmpLogic::internalHasPrivatizedParts(ParallelData* parallelData) {
+
+  for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+    std::vector<AdjointAccessMode> const& modes = parallelData->childTaskData[i]->adjointAccessModes;
+
+    if (std::find(modes.begin(), modes.end(), AdjointAccessMode::Privatized) != modes.end()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool opdi::ParallelOmpLogic::internalPrefersSerialEvaluation(ParallelData* parallelData) {
+
+  // implicit tasks can be evaluated one after another if they do not wait for each other
+  std::size_t nStatements = 0;
+  for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+    ImplicitTaskData* implicitTaskData = parallelData->childTaskData[i];
+
+    if (implicitTaskData->nSynchronizingHandles != 0) {
+      return false;
+    }
+
+    std::size_t nTaskStatements = boundTool()->getStatementCount(implicitTaskData->newTape,
+                                                                 implicitTaskData->positions.back(),
+                                                                 implicitTaskData->positions.front());
+    if (nTaskStatements > OPDI_REVERSE_SERIAL_THRESHOLD - nStatements) {
+      return false;
+    }
+    nStatements += nTaskStatements;
+  }
+
+  return true;
+}
+
+void opdi::ParallelOmpLogic::reverseFunc(void* parallelDataPtr) {
+
+  assert(tool != nullptr);
+
+  ParallelData* parallelData = static_cast<ParallelData*>(parallelDataPtr);
+
+  #if OPDI_OMP_LOGIC_INSTRUMENT
+    for (auto& instrument : ompLogicInstruments) {
+      instrument->reverseParallelBegin(parallelData);
     }
+  #endif
+
+  ParallelOmpLogic::internalBeginSkippedParallelRegion();
+
+  // updates that the encountering task buffered so far have to be visible to the evaluation of this region
+  void* encounteringTaskAdjointBuffer = AdjointBuffers::getActiveBuffer();
+  if (encounteringTaskAdjointBuffer != nullptr) {
+    boundTool()->mergeAdjointBuffers(&encounteringTaskAdjointBuffer, 1, 0, 1, true);
+    AdjointBuffers::setActiveBuffer(nullptr);
+  }
+
+  #if OPDI_ELASTIC_REVERSE_TEAM
+    // waits inside nested parallel regions must not yield to the logical threads of an enclosing team
+    void* elasticScheduler = ElasticTeam::suspend();
+  #endif
+
+  #if OPDI_REVERSE_BARRIER != OPDI_REVERSE_BARRIER_OMP || OPDI_ELASTIC_REVERSE_TEAM
+    parallelData->reverseBarrier = RecyclingPool<ReverseBarrier>::get();
+    parallelData->reverseBarrier->resize(parallelData->actualSizeOfTeam);
+  #endif
+
+  #if OPDI_REVERSE_LOOP_WORK_STEALING
+    WorkOmpLogic::resetLoops(parallelData);
+  #endif
+
+  #if OPDI_REVERSE_SERIAL_THRESHOLD != 0
+    bool useSerialEvaluation = ParallelOmpLogic::internalPrefersSerialEvaluation(parallelData);
+  #else
+    bool useSerialEvaluation = false;
+  #endif
+
+  #if OPDI_PERSISTENT_REVERSE_TEAM
+    bool usePersistentTeam = ReverseTeam::canRun();
+  #else
+    bool usePersistentTeam = false;
+  #endif
+
+  // privatized parts collect adjoint updates per implicit task, the buffers are merged at the end of the region
+  // serial evaluation does not suffer from contention on adjoints and evaluates them with atomic updates instead
+  parallelData->adjointBuffers = nullptr;
+  parallelData->nEvaluated.store(0);
+  #if OPDI_PERSISTENT_REVERSE_TEAM
+    parallelData->isNestedEvaluation = !ReverseTeam::canRun();  // threads of the team are not OpenMP threads
+  #else
+    parallelData->isNestedEvaluation = omp_in_parallel();
+  #endif
+  if (!useSerialEvaluation && ParallelOmpLogic::internalHasPrivatizedParts(parallelData)) {
+    parallelData->adjointBuffers = RecyclingPool<AdjointBuffers>::get();
 
-    tool->setThreadLocalTape(oldTape);
+    if (!parallelData->adjointBuffers->reserve(parallelData->actualSizeOfTeam)) {
+      RecyclingPool<AdjointBuffers>::recycle(parallelData->adjointBuffers);
+      parallelData->adjointBuffers = nullptr;
+    }
+  }
 
+  if (useSerialEvaluation) {
     #if OPDI_OMP_LOGIC_INSTRUMENT
       for (auto& instrument : ompLogicInstruments) {
-        instrument->reverseImplicitTaskEnd(implicitTaskData);
+        instrument->reverseParallelSerial(parallelData);
       }
     #endif
+
+    // small regions do not pay off the start of a team
+    for (int threadNum = 0; threadNum < parallelData->actualSizeOfTeam; ++threadNum) {
+      ParallelOmpLogic::reverseImplicitTask(parallelDataPtr, threadNum);
+    }
   }
+  else if (usePersistentTeam) {
+    ReverseTeam::run(ParallelOmpLogic::reverseImplicitTaskAndMerge, parallelDataPtr,
+                     parallelData->actualSizeOfTeam);
+  }
+  else {
+    #if OPDI_ELASTIC_REVERSE_TEAM
+      int sizeOfTeam = std::min(parallelData->actualSizeOfTeam, omp_get_max_threads());
+    #else
+      int sizeOfTeam = parallelData->actualSizeOfTeam;
+    #endif
+
+    #pragma omp parallel num_threads(sizeOfTeam)
+    {
+      #if OPDI_ELASTIC_REVERSE_TEAM
+        if (parallelData->actualSizeOfTeam != omp_get_num_threads()) {
+          // run the recorded threads as logical threads on the threads of the smaller team
+          ElasticTeam::run(ParallelOmpLogic::reverseImplicitTaskAndMerge, parallelDataPtr,
+                           parallelData->actualSizeOfTeam, omp_get_thread_num(), omp_get_num_threads());
+        }
+        else {
+          ParallelOmpLogic::reverseImplicitTaskAndMerge(parallelDataPtr, omp_get_thread_num());
+        }
+      #else
+        if (parallelData->actualSizeOfTeam != omp_get_num_threads()) {
+          OPDI_ERROR("Parallel region in the reverse pass does not use the required number of threads.");
+        }
+
+        ParallelOmpLogic::reverseImplicitTaskAndMerge(parallelDataPtr, omp_get_thread_num());
+      #endif
+    }
+  }
+
+  #if OPDI_REVERSE_BARRIER != OPDI_REVERSE_BARRIER_OMP || OPDI_ELASTIC_REVERSE_TEAM
+    RecyclingPool<ReverseBarrier>::recycle(parallelData->reverseBarrier);
+  #endif
+
+  if (parallelData->adjointBuffers != nullptr) {
+    RecyclingPool<AdjointBuffers>::recycle(parallelData->adjointBuffers);
+    parallelData->adjointBuffers = nullptr;
+  }
+
+  #if OPDI_ELASTIC_REVERSE_TEAM
+    ElasticTeam::resume(elasticScheduler);
+  #endif
+
+  AdjointBuffers::setActiveBuffer(encounteringTaskAdjointBuffer);
 
   ParallelOmpLogic::internalEndSkippedParallelRegion();
 
@@ -105,45 +402,124 @@ void opdi::ParallelOmpLogic::reverseFunc(void* parallelDataPtr) {
   #endif
 }
 
-void opdi::ParallelOmpLogic::deleteFunc(void* parallelDataPtr) {
+void opdi::ParallelOmpLogic::cleanup(ParallelData* parallelData) {
 
   assert(tool != nullptr);
 
-  ParallelData* parallelData = static_cast<ParallelData*>(parallelDataPtr);
-
   ParallelOmpLogic::internalBeginSkippedParallelRegion();
 
   // this triggers possibly pending implicit task end events
   #pragma omp parallel num_threads(parallelData->actualSizeOfTeam)
   {
-    if (parallelData->actualSizeOfTeam != omp_get_num_threads()) {
-      OPDI_WARNING("Parallel region during cleanup does not use the required number of threads.");
+    #if !OPDI_ELASTIC_REVERSE_TEAM
+      if (parallelData->actualSizeOfTeam != omp_get_num_threads()) {
+        OPDI_WARNING("Parallel region during cleanup does not use the required number of threads.");
+      }
+    #endif
+
+    // smaller teams reset the tapes of several implicit tasks per thread
+    for (int threadNum = omp_get_thread_num(); threadNum < parallelData->actualSizeOfTeam;
+         threadNum += omp_get_num_threads()) {
+
+      ImplicitTaskData* implicitTaskData = parallelData->childTaskData[threadNum];
+
+      void* oldTape = boundTool()->getThreadLocalTape();
+      boundTool()->setThreadLocalTape(implicitTaskData->newTape);
+
+      boundTool()->reset(implicitTaskData->newTape, implicitTaskData->positions[0], OPDI_OMP_LOGIC_CLEAR_ADJOINTS);
+
+      boundTool()->setThreadLocalTape(oldTape);
+
+      // recycle data of child tasks
+      RecyclingPool<ImplicitTaskData>::recycle(implicitTaskData);
     }
+  }
+
+  ParallelOmpLogic::internalEndSkippedParallelRegion();
+
+  boundTool()->freePosition(parallelData->encounteringTaskTapePosition);
+
+  // recycle data of the parallel region
+  RecyclingPool<ParallelData>::recycle(parallelData);
+}
+
+void opdi::ParallelOmpLogic::deleteFunc(void* parallelDataPtr) {
+
+  ParallelData* parallelData = static_cast<ParallelData*>(parallelDataPtr);
+
+  #if OPDI_DEFERRED_TAPE_CLEANUP
+    // tapes that are reset inside parallel regions might be recorded on again right away
+    if (omp_get_level() == 0) {
+      ParallelOmpLogic::pendingCleanup.push_back(parallelData);
+      return;
+    }
+  #endif
+
+  ParallelOmpLogic::cleanup(parallelData);
+}
+
+// not thread-safe! only use outside of parallel regions
+void opdi::ParallelOmpLogic::internalCompleteCleanup() {
+
+  if (ParallelOmpLogic::pendingCleanup.empty()) {
+    return;
+  }
 
-    int threadNum = omp_get_thread_num();
+  assert(tool != nullptr);
 
-    ImplicitTaskData* implicitTaskData = parallelData->childTaskData[threadNum];
+  // each child tape is reset only once, to the earliest position of all pending parallel regions
+  // positions are copied since pending implicit task end events might still modify the task data
+  std::vector<void*> tapes;
+  PositionBuffer positions;
+  positions.setPositionSize(boundTool()->getPositionSize());
+  std::unordered_map<void*, std::size_t> tapeIndices;
+  int maximumSizeOfTeam = 0;
+
+  for (ParallelData* parallelData : ParallelOmpLogic::pendingCleanup) {
+    maximumSizeOfTeam = std::max(maximumSizeOfTeam, parallelData->actualSizeOfTeam);
+
+    for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+      ImplicitTaskData* implicitTaskData = parallelData->childTaskData[i];
+      auto iter = tapeIndices.find(implicitTaskData->newTape);
+
+      if (iter == tapeIndices.end()) {
+        tapeIndices[implicitTaskData->newTape] = tapes.size();
+        tapes.push_back(implicitTaskData->newTape);
+        boundTool()->copyPosition(positions.push_back(), implicitTaskData->positions[0]);
+      }
+      else if (boundTool()->comparePosition(implicitTaskData->positions[0], positions[iter->second]) < 0) {
+        boundTool()->copyPosition(positions[iter->second], implicitTaskData->positions[0]);
+      }
+    }
+  }
 
-    void* oldTape = tool->getThreadLocalTape();
-    tool->setThreadLocalTape(implicitTaskData->newTape);
+  ParallelOmpLogic::internalBeginSkippedParallelRegion();
 
-    tool->reset(implicitTaskData->newTape, implicitTaskData->positions[0], OPDI_OMP_LOGIC_CLEAR_ADJOINTS);
+  // this triggers possibly pending implicit task end events
+  #pragma omp parallel num_threads(maximumSizeOfTeam)
+  {
+    for (std::size_t i = omp_get_thread_num(); i < tapes.size(); i += omp_get_num_threads()) {
+      void* oldTape = boundTool()->getThreadLocalTape();
+      boundTool()->setThreadLocalTape(tapes[i]);
 
-    tool->setThreadLocalTape(oldTape);
+      boundTool()->reset(tapes[i], positions[i], OPDI_OMP_LOGIC_CLEAR_ADJOINTS);
 
-    // delete data of child tasks
-    for (auto const& pos : implicitTaskData->positions) {
-      tool->freePosition(pos);
+      boundTool()->setThreadLocalTape(oldTape);
     }
-    delete implicitTaskData;
   }
 
   ParallelOmpLogic::internalEndSkippedParallelRegion();
 
-  tool->freePosition(parallelData->encounteringTaskTapePosition);
+  for (ParallelData* parallelData : ParallelOmpLogic::pendingCleanup) {
+    for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+      RecyclingPool<ImplicitTaskData>::recycle(parallelData->childTaskData[i]);
+    }
+
+    boundTool()->freePosition(parallelData->encounteringTaskTapePosition);
+    RecyclingPool<ParallelData>::recycle(parallelData);
+  }
 
-  // delete data of the parallel region
-  delete parallelData;
+  ParallelOmpLogic::pendingCleanup.clear();
 }
 
 opdi::LogicInterface::AdjointAccessMode opdi::ParallelOmpLogic::internalGetAdjointAccessMode(
@@ -153,21 +529,42 @@ opdi::LogicInterface::AdjointAccessMode opdi::ParallelOmpLogic::internalGetAdjoi
 
 void opdi::ParallelOmpLogic::internalSetAdjointAccessMode(ImplicitTaskData* implicitTaskData, AdjointAccessMode mode) {
 
+  // no new part is needed if the mode does not change
+  if (implicitTaskData->adjointAccessModes.back() == mode) {
+    return;
+  }
+
   if (implicitTaskData->isInitialImplicitTask) {
     implicitTaskData->adjointAccessModes.back() = mode;
   }
   else {
     if (tool != nullptr) {
-      void* position = tool->allocPosition();
-      tool->getTapePosition(implicitTaskData->newTape, position);
+      // tentatively append the current position, drop it again if it matches the previous one
+      boundTool()->getTapePosition(implicitTaskData->newTape, implicitTaskData->positions.push_back());
 
-      if (tool->comparePosition(implicitTaskData->positions.back(), position) == 0) {
+      std::size_t nPositions = implicitTaskData->positions.size();
+      if (boundTool()->comparePosition(implicitTaskData->positions[nPositions - 2],
+                                implicitTaskData->positions[nPositions - 1]) == 0) {
+        implicitTaskData->positions.pop_back();
         implicitTaskData->adjointAccessModes.back() = mode;
-        tool->freePosition(position);
+
+        // the current part is empty, it merges with the previous part if that has the same mode
+        std::size_t currentPart = implicitTaskData->positions.size() - 1;
+        bool isMergeable = currentPart != 0 && implicitTaskData->adjointAccessModes[currentPart - 1] == mode;
+
+        #if OPDI_REVERSE_LOOP_WORK_STEALING
+          // parts are not merged across loop boundaries
+          isMergeable = isMergeable && (implicitTaskData->loops.empty() ||
+                                        implicitTaskData->loops.back().part < currentPart);
+        #endif
+
+        if (isMergeable) {
+          implicitTaskData->positions.pop_back();
+          implicitTaskData->adjointAccessModes.pop_back();
+        }
       }
       else {
         implicitTaskData->adjointAccessModes.push_back(mode);
-        implicitTaskData->positions.push_back(position);
       }
     }
   }
@@ -175,23 +572,41 @@ void opdi::ParallelOmpLogic::internalSetAdjointAccessMode(ImplicitTaskData* impl
 
 void* opdi::ParallelOmpLogic::onParallelBegin(void* encounteringTaskDataPtr, int maximumSizeOfTeam) {
 
-  if (tool != nullptr && tool->getThreadLocalTape() != nullptr && ParallelOmpLogic::skipParallelRegion == 0) {
+  if (tool != nullptr && boundTool()->getThreadLocalTape() != nullptr && ParallelOmpLogic::skipParallelRegion == 0) {
 
     ImplicitTaskData* encounteringTaskData = static_cast<ImplicitTaskData*>(encounteringTaskDataPtr);
 
+    #if OPDI_DEFERRED_TAPE_CLEANUP
+      if (!ParallelOmpLogic::pendingCleanup.empty()) {
+        OPDI_ERROR("Tape cleanup is pending. Call reset or recoverState of the logic after resetting tapes.");
+      }
+    #endif
+
     assert(encounteringTaskData != nullptr);
-    assert(encounteringTaskData->isInitialImplicitTask || tool->getThreadLocalTape() == encounteringTaskData->newTape);
+    assert(encounteringTaskData->isInitialImplicitTask ||
+           boundTool()->getThreadLocalTape() == encounteringTaskData->newTape);
 
-    ParallelData* parallelData = new ParallelData;
+    ParallelData* parallelData = RecyclingPool<ParallelData>::get();
 
     parallelData->maximumSizeOfTeam = maximumSizeOfTeam;
-    parallelData->isActiveParallelRegion = tool->isActive(tool->getThreadLocalTape());
+    parallelData->isActiveParallelRegion = RecordingState::isRecording();
     parallelData->encounteringTaskData = encounteringTaskData;
-    parallelData->encounteringTaskTape = tool->getThreadLocalTape();
-    parallelData->encounteringTaskTapePosition = tool->allocPosition();
-    tool->getTapePosition(parallelData->encounteringTaskTape, parallelData->encounteringTaskTapePosition);
+    parallelData->encounteringTaskTape = boundTool()->getThreadLocalTape();
+    parallelData->encounteringTaskTapePosition = nullptr;
+    if (parallelData->isActiveParallelRegion) {
+      parallelData->encounteringTaskTapePosition = boundTool()->allocPosition();
+      boundTool()->getTapePosition(parallelData->encounteringTaskTape, parallelData->encounteringTaskTapePosition);
+    }
     parallelData->encounteringTaskAdjointAccessMode = internalGetAdjointAccessMode(encounteringTaskData);
-    parallelData->childTaskData.resize(maximumSizeOfTeam);
+    parallelData->childTapes = this->tapePool.getTapes(parallelData->encounteringTaskTape, maximumSizeOfTeam);
+    parallelData->childTaskData.assign(maximumSizeOfTeam, nullptr);
+    parallelData->nPendingEvents.store(1);
+    parallelData->reverseBarrier = nullptr;
+    #if OPDI_REVERSE_BARRIER_COALESCING
+      parallelData->reverseBarrierRequired.reset();
+    #endif
+    parallelData->isLoopWorkStealingDisabled.store(false);
+    parallelData->adjointBuffers = nullptr;
 
     #if OPDI_OMP_LOGIC_INSTRUMENT
       for (auto& instrument : ompLogicInstruments) {
@@ -232,7 +647,10 @@ void opdi::ParallelOmpLogic::onParallelEnd(void* parallelDataPtr) {
       handle->reverseFunc = ParallelOmpLogic::reverseFunc;
       handle->deleteFunc = ParallelOmpLogic::deleteFunc;
 
-      tool->pushExternalFunction(parallelData->encounteringTaskTape, handle);
+      boundTool()->pushExternalFunction(parallelData->encounteringTaskTape, handle);
+
+      // nested parallel regions synchronize in the reverse pass, too
+      ++RecordingState::nSynchronizingHandles;
 
       // do not delete data, it is deleted with the handle
     }
@@ -245,7 +663,8 @@ void opdi::ParallelOmpLogic::onParallelEnd(void* parallelDataPtr) {
                                          implicitTaskData->adjointAccessModes.back());
 
     if (!parallelData->isActiveParallelRegion) {
-      deleteFunc(parallelData);
+      // nothing was recorded, hence there is no need to reset tapes
+      ImplicitTaskOmpLogic::releasePassiveParallelRegion(parallelData);
     }
   }
   #if OPDI_OMP_LOGIC_INSTRUMENT
@@ -287,6 +706,51 @@ opdi::LogicInterface::AdjointAccessMode opdi::ParallelOmpLogic::getAdjointAccess
   }
 }
 
+void opdi::ParallelOmpLogic::addOwnedAdjoints(std::size_t begin, std::size_t end) {
+
+  assert(backend != nullptr);
+
+  void* implicitTaskDataPtr = backend->getImplicitTaskData();
+  if (implicitTaskDataPtr != nullptr) {  // nullptr if called during tape evaluation
+    #if OPDI_OMP_LOGIC_INSTRUMENT
+      for (auto& instrument : ompLogicInstruments) {
+        instrument->onAddOwnedAdjoints(begin, end);
+      }
+    #endif
+
+    ImplicitTaskData* implicitTaskData = static_cast<ImplicitTaskData*>(implicitTaskDataPtr);
+
+    // initial implicit tasks are not evaluated concurrently to other threads
+    if (implicitTaskData->isInitialImplicitTask || begin >= end) {
+      return;
+    }
+
+    // insert in order, merge with overlapping or adjacent ranges
+    std::vector<ToolInterface::AdjointRange>& ranges = implicitTaskData->ownedAdjoints;
+    auto iter = ranges.insert(std::upper_bound(ranges.begin(), ranges.end(), ToolInterface::AdjointRange(begin, end)),
+                              ToolInterface::AdjointRange(begin, end));
+
+    if (iter != ranges.begin() && std::prev(iter)->second >= iter->first) {
+      std::prev(iter)->second = std::max(std::prev(iter)->second, iter->second);
+      iter = std::prev(ranges.erase(iter));
+    }
+
+    while (std::next(iter) != ranges.end() && std::next(iter)->first <= iter->second) {
+      iter->second = std::max(iter->second, std::next(iter)->second);
+      ranges.erase(std::next(iter));
+    }
+  }
+}
+
+// not thread-safe! only use outside of parallel regions
+void opdi::ParallelOmpLogic::reserveTapes(int nestingDepth, int sizeOfTeam, std::size_t expectedTapeSize) {
+
+  assert(tool != nullptr);
+  assert(boundTool()->getThreadLocalTape() != nullptr);
+
+  this->tapePool.reserve(boundTool()->getThreadLocalTape(), nestingDepth, sizeOfTeam, expectedTapeSize);
+}
+
 void opdi::ParallelOmpLogic::internalBeginSkippedParallelRegion() {
   ++ParallelOmpLogic::skipParallelRegion;
 }
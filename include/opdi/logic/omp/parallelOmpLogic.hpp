@@ -25,8 +25,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 
+#include "../../misc/adjointBuffers.hpp"
+#include "../../misc/flagArray.hpp"
+#include "../../misc/recyclingPool.hpp"
+#include "../../misc/reverseBarrier.hpp"
 #include "../../misc/tapePool.hpp"
 
 #include "../logicInterface.hpp"
@@ -43,8 +48,16 @@ namespace opdi {
       ImplicitTaskData* encounteringTaskData;
       void* encounteringTaskTape;
       void* encounteringTaskTapePosition;
+      void* const* childTapes;  // only valid until the end of the parallel region
+      std::atomic<int> nPendingEvents;  // implicit task end and parallel end events of passive parallel regions
       LogicInterface::AdjointAccessMode encounteringTaskAdjointAccessMode;
       std::vector<ImplicitTaskData*> childTaskData;
+      ReverseBarrier* reverseBarrier;  // only valid during the evaluation of the parallel region
+      FlagArray reverseBarrierRequired;  // per recorded barrier, whether any thread recorded something before it
+      std::atomic<bool> isLoopWorkStealingDisabled;  // set if recorded loops were discarded in some implicit task
+      AdjointBuffers* adjointBuffers;  // only valid during the evaluation of the parallel region, if it is privatized
+      std::atomic<int> nEvaluated;  // implicit tasks whose adjoint updates are complete in the reverse pass
+      bool isNestedEvaluation;  // whether other threads might evaluate concurrently to the parallel region
   };
 
   struct ParallelOmpLogic : public virtual LogicInterface {
@@ -52,15 +65,31 @@ namespace opdi {
 
       using LogicInterface::AdjointAccessMode;
 
+    protected:
+      TapePool tapePool;
+
+      void internalInit();
+      void internalFinalize();
+
+      static void internalCompleteCleanup();
+
     private:
 
       static int skipParallelRegion;
       #pragma omp threadprivate(skipParallelRegion)
 
+      static std::vector<ParallelData*> pendingCleanup;
+
       static void internalBeginSkippedParallelRegion();
       static void internalEndSkippedParallelRegion();
 
+      static bool internalPrefersSerialEvaluation(ParallelData* parallelData);
+      static bool internalHasPrivatizedParts(ParallelData* parallelData);
+
+      static void reverseImplicitTask(void* parallelData, int threadNum);
+      static void reverseImplicitTaskAndMerge(void* parallelData, int threadNum);
       static void reverseFunc(void* parallelData);
+      static void cleanup(ParallelData* parallelData);
       static void deleteFunc(void* parallelData);
 
       AdjointAccessMode internalGetAdjointAccessMode(ImplicitTaskData* implicitTaskData) const;
@@ -74,6 +103,10 @@ namespace opdi {
       virtual void setAdjointAccessMode(AdjointAccessMode mode);
       virtual AdjointAccessMode getAdjointAccessMode() const;
 
+      virtual void addOwnedAdjoints(std::size_t begin, std::size_t end);
+
+      virtual void reserveTapes(int nestingDepth, int sizeOfTeam, std::size_t expectedTapeSize);
+
       virtual void beginSkippedParallelRegion();
       virtual void endSkippedParallelRegion();
   };
@@ -0,0 +1,38 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../tool/boundTool.hpp"
+
+#include "recordingState.hpp"
+
+bool opdi::RecordingState::inPassiveParallelRegion = false;
+opdi::RecordingState::TapeActivity opdi::RecordingState::tapeActivity = opdi::RecordingState::TapeActivity::Unknown;
+int opdi::RecordingState::skipReverseSynchronizationDepth = 0;
+std::size_t opdi::RecordingState::nSynchronizingHandles = 0;
+
+bool opdi::RecordingState::isTapeActive() {
+  return tool != nullptr && boundTool()->getThreadLocalTape() != nullptr &&
+         boundTool()->isActive(boundTool()->getThreadLocalTape());
+}
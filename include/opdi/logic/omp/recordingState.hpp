@@ -0,0 +1,84 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+
+#include "../../tool/toolInterface.hpp"
+
+namespace opdi {
+
+  // per-thread knowledge about the recording that spares queries to the tool
+  struct RecordingState {
+    public:
+
+      // nothing may be recorded in passive parallel regions
+      static bool inPassiveParallelRegion;
+      #pragma omp threadprivate(inPassiveParallelRegion)
+
+      enum class TapeActivity {
+        Unknown, Active, Passive
+      };
+
+      // cached activity of the thread-local tape, known in implicit tasks of parallel regions handled by OpDiLib
+      // set on implicit task begin, updated by the logic's updateTapeActivity, restored on implicit task end
+      static TapeActivity tapeActivity;
+      #pragma omp threadprivate(tapeActivity)
+
+      // depth of nested scopes in the current implicit task that do not require reverse synchronization
+      static int skipReverseSynchronizationDepth;
+      #pragma omp threadprivate(skipReverseSynchronizationDepth)
+
+      static bool skipsReverseSynchronization() {
+        return RecordingState::skipReverseSynchronizationDepth != 0;
+      }
+
+      // number of recorded handles that synchronize the current thread with other threads in the reverse pass
+      // nested parallel regions do not count, their reverse pass is independent of the thread that starts it
+      static std::size_t nSynchronizingHandles;
+      #pragma omp threadprivate(nSynchronizingHandles)
+
+      // queries the tool whether the thread-local tape is active
+      static bool isTapeActive();
+
+      // whether AD events of the current thread have to be recorded
+      static bool isRecording() {
+        if (RecordingState::inPassiveParallelRegion) {
+          return false;
+        }
+
+        if (RecordingState::tapeActivity == TapeActivity::Unknown) {
+          return RecordingState::isTapeActive();
+        }
+
+        // tapes that were set passive without calling the logic's updateTapeActivity would still be recorded on
+        assert(RecordingState::tapeActivity == TapeActivity::Passive || RecordingState::isTapeActive());
+
+        return RecordingState::tapeActivity == TapeActivity::Active;
+      }
+  };
+}
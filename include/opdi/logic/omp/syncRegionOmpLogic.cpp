@@ -23,31 +23,51 @@
  *
  */
 
+#include <cassert>
+
+#include "../../backend/backendInterface.hpp"
 #include "../../config.hpp"
-#include "../../tool/toolInterface.hpp"
+#include "../../misc/reverseBarrier.hpp"
+#include "../../misc/reverseTeam.hpp"
+#include "../../tool/boundTool.hpp"
 
 #include "instrument/ompLogicInstrumentInterface.hpp"
 
+#include "implicitTaskOmpLogic.hpp"
+#include "parallelOmpLogic.hpp"
 #include "syncRegionOmpLogic.hpp"
+#include "recordingState.hpp"
 
 void opdi::SyncRegionOmpLogic::reverseFunc(void* dataPtr) {
 
+  Data* data = static_cast<Data*>(dataPtr);
+
+  // no thread has adjoint work between this and the next reverse barrier
+  if (data->required != nullptr && !data->required->load()) {
+    return;
+  }
+
   #if OPDI_OMP_LOGIC_INSTRUMENT
-    Data* data = static_cast<Data*>(dataPtr);
     for (auto& instrument : ompLogicInstruments) {
       instrument->reverseSyncRegion(data);
     }
-  #else
-    OPDI_UNUSED(dataPtr);
   #endif
 
-  #pragma omp barrier
-}
+  #if OPDI_REVERSE_BARRIER != OPDI_REVERSE_BARRIER_OMP || OPDI_ELASTIC_REVERSE_TEAM
+    if (ReverseBarrier::isMember()) {
+      ReverseBarrier::wait();
+      return;
+    }
+  #endif
 
-void opdi::SyncRegionOmpLogic::deleteFunc(void* dataPtr) {
+  #if OPDI_PERSISTENT_REVERSE_TEAM
+    if (ReverseTeam::isMember()) {
+      ReverseTeam::barrier();
+      return;
+    }
+  #endif
 
-  Data* data = static_cast<Data*>(dataPtr);
-  delete data;
+  #pragma omp barrier
 }
 
 bool opdi::SyncRegionOmpLogic::requiresReverseBarrier(SyncRegionKind kind, ScopeEndpoint endpoint) {
@@ -66,30 +86,73 @@ bool opdi::SyncRegionOmpLogic::requiresReverseBarrier(SyncRegionKind kind, Scope
   return syncRegionBehaviour[kind - 1] & endpoint;
 }
 
+// consecutive reverse barriers without adjoint work in between on all threads are coalesced
+// each thread marks a recorded barrier as required if its tape grew since its previous recorded barrier
+// the marks are complete when the parallel region ends, hence all threads agree on them in the reverse pass
+// a barrier that is preceded only by empty segments is also redundant, since it is followed by the reverse join
+std::atomic<bool> const* opdi::SyncRegionOmpLogic::internalBeginReverseBarrier() {
+
+  #if OPDI_REVERSE_BARRIER_COALESCING
+    ImplicitTaskData* implicitTaskData = static_cast<ImplicitTaskData*>(backend->getImplicitTaskData());
+
+    if (implicitTaskData->isInitialImplicitTask) {
+      return nullptr;
+    }
+
+    void* previousPosition = implicitTaskData->reverseBarrierPositions[0];
+    void* currentPosition = implicitTaskData->reverseBarrierPositions[1];
+    boundTool()->getTapePosition(boundTool()->getThreadLocalTape(), currentPosition);
+
+    std::atomic<bool>& required =
+        implicitTaskData->parallelData->reverseBarrierRequired[implicitTaskData->nReverseBarriers++];
+    if (boundTool()->comparePosition(previousPosition, currentPosition) != 0) {
+      required.store(true);
+    }
+
+    return &required;
+  #else
+    return nullptr;
+  #endif
+}
+
+void opdi::SyncRegionOmpLogic::internalEndReverseBarrier() {
+
+  #if OPDI_REVERSE_BARRIER_COALESCING
+    ImplicitTaskData* implicitTaskData = static_cast<ImplicitTaskData*>(backend->getImplicitTaskData());
+
+    if (!implicitTaskData->isInitialImplicitTask) {
+      // the segment of the next barrier starts after the handle of this one
+      boundTool()->getTapePosition(boundTool()->getThreadLocalTape(), implicitTaskData->reverseBarrierPositions[0]);
+    }
+  #endif
+}
+
 void opdi::SyncRegionOmpLogic::onSyncRegion(SyncRegionKind kind, ScopeEndpoint endpoint) {
 
-  if (tool != nullptr && tool->getThreadLocalTape() != nullptr && tool->isActive(tool->getThreadLocalTape())) {
+  if (RecordingState::isRecording()) {
 
-    Data* data = new Data;
-    data->kind = kind;
-    data->endpoint = endpoint;
+    Data data;
+    data.kind = kind;
+    data.endpoint = endpoint;
+    data.required = nullptr;
 
     #if OPDI_OMP_LOGIC_INSTRUMENT
       for (auto& instrument : ompLogicInstruments) {
-        instrument->onSyncRegion(data);
+        instrument->onSyncRegion(&data);
       }
     #endif
 
-    if (requiresReverseBarrier(kind, endpoint)) {
-      Handle* handle = new Handle;
-      handle->data = static_cast<void*>(data);
-      handle->reverseFunc = SyncRegionOmpLogic::reverseFunc;
-      handle->deleteFunc = SyncRegionOmpLogic::deleteFunc;
+    if (requiresReverseBarrier(kind, endpoint) && !RecordingState::skipsReverseSynchronization()) {
+      data.required = SyncRegionOmpLogic::internalBeginReverseBarrier();
 
-      tool->pushExternalFunction(tool->getThreadLocalTape(), handle);
-    }
-    else {
-      delete data;
+      InlineHandle handle;
+      handle.setData(data);
+      handle.reverseFunc = SyncRegionOmpLogic::reverseFunc;
+
+      boundTool()->pushInlineExternalFunction(boundTool()->getThreadLocalTape(), handle);
+      ++RecordingState::nSynchronizingHandles;
+
+      SyncRegionOmpLogic::internalEndReverseBarrier();
     }
   }
 }
@@ -99,3 +162,12 @@ void opdi::SyncRegionOmpLogic::addReverseBarrier() {
   this->onSyncRegion(SyncRegionKind::BarrierReverse, ScopeEndpoint::Begin);
   this->onSyncRegion(SyncRegionKind::BarrierReverse, ScopeEndpoint::End);
 }
+
+void opdi::SyncRegionOmpLogic::beginSkippedReverseSynchronization() {
+  ++RecordingState::skipReverseSynchronizationDepth;
+}
+
+void opdi::SyncRegionOmpLogic::endSkippedReverseSynchronization() {
+  assert(RecordingState::skipReverseSynchronizationDepth > 0);
+  --RecordingState::skipReverseSynchronizationDepth;
+}
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "../../config.hpp"
 
 #include "../logicInterface.hpp"
@@ -41,6 +43,7 @@ namespace opdi {
         public:
           SyncRegionKind kind;
           ScopeEndpoint endpoint;
+          std::atomic<bool> const* required;  // if not null, the reverse barrier is skipped unless it is set
       };
 
       bool requiresReverseBarrier(SyncRegionKind kind, ScopeEndpoint endpoint);
@@ -48,11 +51,16 @@ namespace opdi {
     private:
 
       static void reverseFunc(void* dataPtr);
-      static void deleteFunc(void* dataPtr);
+
+      static std::atomic<bool> const* internalBeginReverseBarrier();
+      static void internalEndReverseBarrier();
 
     public:
 
       virtual void onSyncRegion(SyncRegionKind kind, ScopeEndpoint endpoint);
       virtual void addReverseBarrier();
+
+      virtual void beginSkippedReverseSynchronization();
+      virtual void endSkippedReverseSynchronization();
   };
 }
@@ -25,12 +25,17 @@
 
 #include <omp.h>
 
+#include "../../backend/backendInterface.hpp"
 #include "../../config.hpp"
-#include "../../tool/toolInterface.hpp"
+#include "../../misc/waitPolicy.hpp"
+#include "../../tool/boundTool.hpp"
 
 #include "instrument/ompLogicInstrumentInterface.hpp"
 
+#include "implicitTaskOmpLogic.hpp"
+#include "parallelOmpLogic.hpp"
 #include "workOmpLogic.hpp"
+#include "recordingState.hpp"
 
 void opdi::WorkOmpLogic::reverseFunc(void *dataPtr) {
 
@@ -44,30 +49,161 @@ void opdi::WorkOmpLogic::reverseFunc(void *dataPtr) {
   #endif
 }
 
-void opdi::WorkOmpLogic::deleteFunc(void* dataPtr) {
+void opdi::WorkOmpLogic::internalBeginLoop(ImplicitTaskData* implicitTaskData) {
 
-  Data* data = static_cast<Data*>(dataPtr);
-  delete data;
+  // the loop begins a new part of the implicit task, unless the previous part is empty
+  boundTool()->getTapePosition(implicitTaskData->newTape, implicitTaskData->positions.push_back());
+
+  std::size_t nPositions = implicitTaskData->positions.size();
+  if (boundTool()->comparePosition(implicitTaskData->positions[nPositions - 2],
+                                   implicitTaskData->positions[nPositions - 1]) == 0) {
+    implicitTaskData->positions.pop_back();
+  }
+  else {
+    implicitTaskData->adjointAccessModes.push_back(implicitTaskData->adjointAccessModes.back());
+  }
+
+  implicitTaskData->loops.emplace_back();
+  LoopData& loop = implicitTaskData->loops.back();
+
+  loop.isOpen = true;
+  loop.isStealable = false;
+  loop.part = implicitTaskData->positions.size() - 1;  // index of the loop begin until the loop ends
+  loop.firstChunk = implicitTaskData->loopChunkPositions.size();
+  loop.nChunks = 0;
+  loop.nSynchronizingHandles = RecordingState::nSynchronizingHandles;
+
+  boundTool()->copyPosition(implicitTaskData->loopChunkPositions.push_back(), implicitTaskData->positions.back());
+}
+
+void opdi::WorkOmpLogic::internalEndLoop(ImplicitTaskData* implicitTaskData) {
+
+  LoopData& loop = implicitTaskData->loops.back();
+  std::size_t beginPart = loop.part;
+
+  boundTool()->getTapePosition(implicitTaskData->newTape, implicitTaskData->positions.push_back());
+
+  std::size_t nPositions = implicitTaskData->positions.size();
+  if (boundTool()->comparePosition(implicitTaskData->positions[nPositions - 2],
+                                   implicitTaskData->positions[nPositions - 1]) == 0) {
+    implicitTaskData->positions.pop_back();
+  }
+  else {
+    implicitTaskData->adjointAccessModes.push_back(implicitTaskData->adjointAccessModes.back());
+  }
+
+  loop.isOpen = false;
+  loop.part = implicitTaskData->positions.size() - 1;
+
+  // the last chunk ends with the loop
+  PositionBuffer& chunkPositions = implicitTaskData->loopChunkPositions;
+  if (boundTool()->comparePosition(chunkPositions.back(), implicitTaskData->positions.back()) != 0) {
+    boundTool()->copyPosition(chunkPositions.push_back(), implicitTaskData->positions.back());
+  }
+  loop.nChunks = chunkPositions.size() - loop.firstChunk - 1;
+
+  // chunks are independent if the loop is a single atomic part without synchronization
+  loop.isStealable = loop.nChunks != 0 && loop.part == beginPart + 1 &&
+                     implicitTaskData->adjointAccessModes[beginPart] == AdjointAccessMode::Atomic &&
+                     loop.nSynchronizingHandles == RecordingState::nSynchronizingHandles;
+}
+
+void opdi::WorkOmpLogic::internalEvaluateChunks(ImplicitTaskData* implicitTaskData, LoopData& loop) {
+
+  void* oldTape = boundTool()->getThreadLocalTape();
+  boundTool()->setThreadLocalTape(implicitTaskData->newTape);
+
+  // chunks are taken from the end of the loop
+  std::size_t nTaken;
+  while ((nTaken = loop.nTaken.fetch_add(1)) < loop.nChunks) {
+
+    std::size_t chunk = loop.firstChunk + loop.nChunks - 1 - nTaken;
+
+    boundTool()->evaluate(implicitTaskData->newTape,
+                          implicitTaskData->loopChunkPositions[chunk + 1],
+                          implicitTaskData->loopChunkPositions[chunk],
+                          true);
+
+    if (loop.nFinished.fetch_add(1) + 1 == loop.nChunks) {
+      WaitPolicy::notify<OPDI_REVERSE_LOOP_WAIT_POLICY>(&loop.nFinished);
+    }
+  }
+
+  boundTool()->setThreadLocalTape(oldTape);
+}
+
+void opdi::WorkOmpLogic::reverseLoop(ParallelData* parallelData, int threadNum, std::size_t loopIndex) {
+
+  LoopData& ownLoop = parallelData->childTaskData[threadNum]->loops[loopIndex];
+
+  // all parts of this thread after the loop are evaluated, others may take chunks from now on
+  ownLoop.isPublished.store(true);
+
+  // start with own chunks, then help the other threads
+  for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+
+    ImplicitTaskData* implicitTaskData = parallelData->childTaskData[(threadNum + i) % parallelData->actualSizeOfTeam];
+
+    if (loopIndex < implicitTaskData->loops.size()) {
+      LoopData& loop = implicitTaskData->loops[loopIndex];
+
+      if (loop.isStealable && loop.isPublished.load()) {
+        WorkOmpLogic::internalEvaluateChunks(implicitTaskData, loop);
+      }
+    }
+  }
+
+  // parts of this thread before the loop may depend on chunks that other threads are still evaluating
+  WaitPolicy::wait<OPDI_REVERSE_LOOP_WAIT_POLICY>(&ownLoop.nFinished, [&]() {
+    return ownLoop.nFinished.load() == ownLoop.nChunks;
+  });
+}
+
+void opdi::WorkOmpLogic::resetLoops(ParallelData* parallelData) {
+
+  for (int i = 0; i < parallelData->actualSizeOfTeam; ++i) {
+    for (LoopData& loop : parallelData->childTaskData[i]->loops) {
+      loop.isPublished.store(false);
+      loop.nTaken.store(0);
+      loop.nFinished.store(0);
+    }
+  }
 }
 
 void opdi::WorkOmpLogic::onWork(WorksharingKind kind, ScopeEndpoint endpoint) {
 
-  #if OPDI_OMP_LOGIC_INSTRUMENT
-    if (tool != nullptr && tool->getThreadLocalTape() != nullptr && tool->isActive(tool->getThreadLocalTape())) {
+  #if OPDI_OMP_LOGIC_INSTRUMENT || OPDI_REVERSE_LOOP_WORK_STEALING
+    if (RecordingState::isRecording()) {
 
-        Data* data = new Data;
-        data->kind = kind;
-        data->endpoint = endpoint;
+      #if OPDI_OMP_LOGIC_INSTRUMENT
+        Data data;
+        data.kind = kind;
+        data.endpoint = endpoint;
 
         for (auto& instrument : ompLogicInstruments) {
-          instrument->onWork(data);
+          instrument->onWork(&data);
         }
 
-        Handle* handle = new Handle;
-        handle->data = static_cast<void*>(data);
-        handle->reverseFunc = WorkOmpLogic::reverseFunc;
-        handle->deleteFunc = WorkOmpLogic::deleteFunc;
-        tool->pushExternalFunction(tool->getThreadLocalTape(), handle);
+        InlineHandle handle;
+        handle.setData(data);
+        handle.reverseFunc = WorkOmpLogic::reverseFunc;
+        boundTool()->pushInlineExternalFunction(boundTool()->getThreadLocalTape(), handle);
+      #endif
+
+      #if OPDI_REVERSE_LOOP_WORK_STEALING
+        ImplicitTaskData* implicitTaskData = static_cast<ImplicitTaskData*>(backend->getImplicitTaskData());
+
+        // loops are not recorded if the tool cannot steal chunks
+        if (WorksharingKind::Loop == kind && implicitTaskData != nullptr && !implicitTaskData->isInitialImplicitTask &&
+            boundTool()->supportsConcurrentEvaluation()) {
+          if (ScopeEndpoint::Begin == endpoint) {
+            WorkOmpLogic::internalBeginLoop(implicitTaskData);
+          }
+          else if (!implicitTaskData->loops.empty() && implicitTaskData->loops.back().isOpen) {
+            WorkOmpLogic::internalEndLoop(implicitTaskData);
+          }
+        }
+      #endif
     }
   #else
     OPDI_UNUSED(kind);
@@ -75,3 +211,26 @@ void opdi::WorkOmpLogic::onWork(WorksharingKind kind, ScopeEndpoint endpoint) {
   #endif
 }
 
+void opdi::WorkOmpLogic::onLoopChunk() {
+
+  #if OPDI_REVERSE_LOOP_WORK_STEALING
+    if (RecordingState::isRecording()) {
+
+      ImplicitTaskData* implicitTaskData = static_cast<ImplicitTaskData*>(backend->getImplicitTaskData());
+
+      if (implicitTaskData != nullptr && !implicitTaskData->isInitialImplicitTask &&
+          !implicitTaskData->loops.empty() && implicitTaskData->loops.back().isOpen) {
+
+        // empty chunks are merged into the next one
+        PositionBuffer& chunkPositions = implicitTaskData->loopChunkPositions;
+        boundTool()->getTapePosition(implicitTaskData->newTape, chunkPositions.push_back());
+
+        std::size_t nChunkPositions = chunkPositions.size();
+        if (boundTool()->comparePosition(chunkPositions[nChunkPositions - 2],
+                                         chunkPositions[nChunkPositions - 1]) == 0) {
+          chunkPositions.pop_back();
+        }
+      }
+    }
+  #endif
+}
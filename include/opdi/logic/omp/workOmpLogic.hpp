@@ -25,10 +25,30 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+
 #include "../logicInterface.hpp"
 
 namespace opdi {
 
+  struct ImplicitTaskData;
+  struct ParallelData;
+
+  // chunks of a worksharing loop that were recorded by one thread
+  struct LoopData {
+    public:
+      bool isOpen;
+      bool isStealable;  // whether other threads may evaluate the chunks in the reverse pass
+      std::size_t part;  // index of the loop end in the positions of the implicit task
+      std::size_t firstChunk;  // index of the loop begin in the chunk positions of the implicit task
+      std::size_t nChunks;
+      std::size_t nSynchronizingHandles;  // number of synchronizing handles at the loop begin
+      std::atomic<bool> isPublished;  // only valid during the evaluation of the parallel region
+      std::atomic<std::size_t> nTaken;
+      std::atomic<std::size_t> nFinished;
+  };
+
   struct WorkOmpLogic : public virtual LogicInterface {
     public:
 
@@ -43,10 +63,21 @@ namespace opdi {
     private:
 
       static void reverseFunc(void* dataPtr);
-      static void deleteFunc(void* dataPtr);
+
+      static void internalBeginLoop(ImplicitTaskData* implicitTaskData);
+      static void internalEndLoop(ImplicitTaskData* implicitTaskData);
+      static void internalEvaluateChunks(ImplicitTaskData* implicitTaskData, LoopData& loop);
 
     public:
 
+      // evaluates the chunks of the loop with the given index, shares them with the other threads of the team
+      static void reverseLoop(ParallelData* parallelData, int threadNum, std::size_t loopIndex);
+
+      // prepares the recorded loops of the parallel region for evaluation
+      // not thread-safe! only use outside of parallel regions
+      static void resetLoops(ParallelData* parallelData);
+
       virtual void onWork(WorksharingKind kind, ScopeEndpoint endpoint);
+      virtual void onLoopChunk();
   };
 }
@@ -0,0 +1,82 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "../tool/toolInterface.hpp"
+
+namespace opdi {
+
+  // adjoint buffers of the AD tool, one per thread of a team in the reverse pass
+  // buffers are kept when the object is recycled, so that later evaluations reuse their memory
+  struct AdjointBuffers {
+    private:
+      std::vector<void*> buffers;
+
+      // buffer of the current thread while it evaluates privatized parts
+      static void* activeBuffer;
+      #pragma omp threadprivate(activeBuffer)
+
+    public:
+
+      AdjointBuffers() : buffers() {}
+
+      ~AdjointBuffers() {
+        for (void* buffer : this->buffers) {
+          tool->deleteAdjointBuffer(buffer);
+        }
+      }
+
+      // returns false if the tool does not provide adjoint buffers
+      bool reserve(int sizeOfTeam) {
+        while (this->buffers.size() < static_cast<std::size_t>(sizeOfTeam)) {
+          void* buffer = tool->createAdjointBuffer();
+          if (buffer == nullptr) {
+            return false;
+          }
+          this->buffers.push_back(buffer);
+        }
+        return true;
+      }
+
+      void* operator[](int threadNum) const {
+        return this->buffers[threadNum];
+      }
+
+      void* const* data() const {
+        return this->buffers.data();
+      }
+
+      static void* getActiveBuffer() {
+        return AdjointBuffers::activeBuffer;
+      }
+
+      static void setActiveBuffer(void* buffer) {
+        AdjointBuffers::activeBuffer = buffer;
+      }
+  };
+}
@@ -0,0 +1,195 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include "../config.hpp"
+
+namespace opdi {
+
+  // allocator for small objects that are created and deleted frequently, e.g., data of AD events
+  // blocks are carved from chunks that are shared by all threads, freed blocks are kept in thread-local free lists
+  struct BlockPool {
+    private:
+
+      static std::size_t constexpr blockAlignment = alignof(std::max_align_t);
+      static std::size_t constexpr nSizeClasses = 8;  // block sizes up to nSizeClasses * blockAlignment
+      static std::size_t constexpr nBlocksPerChunk = 256;
+
+      struct FreeBlock {
+        public:
+          FreeBlock* next;
+      };
+
+      // header of each chunk, the chunk's blocks follow after blockAlignment bytes
+      struct Chunk {
+        public:
+          Chunk* next;
+      };
+
+      static_assert(sizeof(Chunk) <= blockAlignment);
+
+      // thread-local allocation state
+      struct Cache {
+        public:
+          std::array<FreeBlock*, nSizeClasses> freeBlocks;
+          std::array<char*, nSizeClasses> chunkBegin;  // unused part of the chunk that is currently carved
+          std::array<char*, nSizeClasses> chunkEnd;
+          std::ptrdiff_t nLive;  // allocations minus deallocations performed by this thread
+          Cache* next;
+
+          Cache() : freeBlocks(), chunkBegin(), chunkEnd(), nLive(0), next(nullptr) {}
+      };
+
+      static Cache* localCache;
+      #pragma omp threadprivate(localCache)
+
+      // all caches and chunks, lists are only appended to in parallel
+      static std::atomic<Cache*> caches;
+      static std::atomic<Chunk*> chunks;
+
+      static std::size_t getSizeClass(std::size_t size) {
+        return (size + blockAlignment - 1) / blockAlignment - 1;
+      }
+
+      template<typename T>
+      static void push(std::atomic<T*>& list, T* element) {
+        element->next = list.load();
+        while (!list.compare_exchange_weak(element->next, element)) {}
+      }
+
+      static Cache& getLocalCache() {
+        if (BlockPool::localCache == nullptr) {
+          BlockPool::localCache = new Cache;
+          BlockPool::push(BlockPool::caches, BlockPool::localCache);
+        }
+        return *BlockPool::localCache;
+      }
+
+      static void* carve(Cache& cache, std::size_t sizeClass) {
+        std::size_t blockSize = (sizeClass + 1) * blockAlignment;
+
+        if (cache.chunkBegin[sizeClass] == cache.chunkEnd[sizeClass]) {
+          char* memory = static_cast<char*>(::operator new(blockAlignment + nBlocksPerChunk * blockSize));
+          BlockPool::push(BlockPool::chunks, reinterpret_cast<Chunk*>(memory));
+
+          cache.chunkBegin[sizeClass] = memory + blockAlignment;
+          cache.chunkEnd[sizeClass] = cache.chunkBegin[sizeClass] + nBlocksPerChunk * blockSize;
+        }
+
+        void* block = cache.chunkBegin[sizeClass];
+        cache.chunkBegin[sizeClass] += blockSize;
+        return block;
+      }
+
+    public:
+
+      static void* allocate(std::size_t size) {
+        #if OPDI_BLOCK_POOL
+          std::size_t sizeClass = BlockPool::getSizeClass(size);
+
+          if (sizeClass < nSizeClasses) {
+            Cache& cache = BlockPool::getLocalCache();
+            cache.nLive += 1;
+
+            FreeBlock* block = cache.freeBlocks[sizeClass];
+            if (block != nullptr) {
+              cache.freeBlocks[sizeClass] = block->next;
+              return static_cast<void*>(block);
+            }
+
+            return BlockPool::carve(cache, sizeClass);
+          }
+        #endif
+
+        return ::operator new(size);
+      }
+
+      // may be called by threads other than the allocating one
+      static void deallocate(void* ptr, std::size_t size) {
+        #if OPDI_BLOCK_POOL
+          std::size_t sizeClass = BlockPool::getSizeClass(size);
+
+          if (sizeClass < nSizeClasses) {
+            Cache& cache = BlockPool::getLocalCache();
+            cache.nLive -= 1;
+
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->next = cache.freeBlocks[sizeClass];
+            cache.freeBlocks[sizeClass] = block;
+            return;
+          }
+        #endif
+
+        ::operator delete(ptr, size);
+      }
+
+      // returns all chunks to the system if no blocks are in use, returns whether memory was released
+      // not thread-safe! only use outside parallel regions
+      static bool release() {
+        std::ptrdiff_t nLive = 0;
+        for (Cache* cache = BlockPool::caches.load(); cache != nullptr; cache = cache->next) {
+          nLive += cache->nLive;
+        }
+
+        if (nLive != 0) {
+          return false;
+        }
+
+        for (Cache* cache = BlockPool::caches.load(); cache != nullptr; cache = cache->next) {
+          cache->freeBlocks.fill(nullptr);
+          cache->chunkBegin.fill(nullptr);
+          cache->chunkEnd.fill(nullptr);
+        }
+
+        Chunk* chunk = BlockPool::chunks.exchange(nullptr);
+        while (chunk != nullptr) {
+          Chunk* next = chunk->next;
+          ::operator delete(static_cast<void*>(chunk));
+          chunk = next;
+        }
+
+        return true;
+      }
+  };
+
+  // base for types whose objects are allocated from the block pool, must not be over-aligned
+  struct BlockPoolObject {
+    public:
+
+      static void* operator new(std::size_t size) {
+        return BlockPool::allocate(size);
+      }
+
+      static void operator delete(void* ptr, std::size_t size) {
+        BlockPool::deallocate(ptr, size);
+      }
+  };
+}
@@ -0,0 +1,206 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#ifdef __linux__
+  #include <ucontext.h>
+#endif
+
+#include "../config.hpp"
+#include "../helpers/exceptions.hpp"
+#include "../helpers/macros.hpp"
+#include "../tool/toolInterface.hpp"
+
+#include "adjointBuffers.hpp"
+#include "recyclingPool.hpp"
+#include "reverseBarrier.hpp"
+#include "waitPolicy.hpp"
+
+namespace opdi {
+
+  // executes a job for more logical threads than there are threads in the current team
+  // each thread runs its share of logical threads as fibers, a fiber yields to the next one whenever it waits
+  struct ElasticTeam {
+    public:
+
+      using Job = void (*)(void* data, int threadNum);
+
+    private:
+
+      // execution state of a logical thread
+      struct Fiber {
+        public:
+          #ifdef __linux__
+            ucontext_t context;
+          #endif
+          std::vector<char> stack;
+          int threadNum;
+          bool isFinished;
+          void* threadLocalTape;
+          ReverseBarrier::Member member;
+          void* adjointBuffer;
+      };
+
+      struct Scheduler {
+        public:
+          #ifdef __linux__
+            ucontext_t context;
+          #endif
+          Job job;
+          void* jobData;
+          Fiber* current;
+      };
+
+      static Scheduler* scheduler;
+      #pragma omp threadprivate(scheduler)
+
+      static void setScheduler(Scheduler* newScheduler) {
+        ElasticTeam::scheduler = newScheduler;
+        WaitPolicy::setYield(newScheduler != nullptr ? ElasticTeam::yield : nullptr);
+      }
+
+      static void entry() {
+        Fiber* fiber = ElasticTeam::scheduler->current;
+        ElasticTeam::scheduler->job(ElasticTeam::scheduler->jobData, fiber->threadNum);
+        fiber->isFinished = true;
+        // returns to the scheduler via uc_link
+      }
+
+      static void yield() {
+        Fiber* fiber = ElasticTeam::scheduler->current;
+
+        // thread-local state of the logical thread
+        fiber->threadLocalTape = tool->getThreadLocalTape();
+        fiber->member = ReverseBarrier::enter(nullptr, 0);
+        fiber->adjointBuffer = AdjointBuffers::getActiveBuffer();
+
+        #ifdef __linux__
+          swapcontext(&fiber->context, &ElasticTeam::scheduler->context);
+        #endif
+
+        tool->setThreadLocalTape(fiber->threadLocalTape);
+        ReverseBarrier::leave(fiber->member);
+        AdjointBuffers::setActiveBuffer(fiber->adjointBuffer);
+      }
+
+      #ifdef __linux__
+        // separate function, getcontext returns twice and would clobber the locals of the caller
+        static Fiber* createFiber(Scheduler* scheduler, int threadNum) {
+          Fiber* fiber = RecyclingPool<Fiber>::get();
+          fiber->stack.resize(OPDI_ELASTIC_REVERSE_TEAM_STACK_SIZE);
+          fiber->threadNum = threadNum;
+          fiber->isFinished = false;
+
+          getcontext(&fiber->context);
+          fiber->context.uc_stack.ss_sp = fiber->stack.data();
+          fiber->context.uc_stack.ss_size = fiber->stack.size();
+          fiber->context.uc_link = &scheduler->context;
+          makecontext(&fiber->context, ElasticTeam::entry, 0);
+
+          return fiber;
+        }
+      #endif
+
+    public:
+
+      // executes the job for the logical threads threadNum, threadNum + nThreads, ... below size
+      // must be called by all threads of the current team
+      static void run(Job job, void* jobData, int size, int threadNum, int nThreads) {
+
+        #ifdef __linux__
+          Scheduler localScheduler;
+          localScheduler.job = job;
+          localScheduler.jobData = jobData;
+          localScheduler.current = nullptr;
+
+          std::vector<Fiber*> fibers;
+          for (int i = threadNum; i < size; i += nThreads) {
+            fibers.push_back(ElasticTeam::createFiber(&localScheduler, i));
+          }
+
+          void* threadLocalTape = tool->getThreadLocalTape();
+          ReverseBarrier::Member member = ReverseBarrier::enter(nullptr, 0);
+          void* adjointBuffer = AdjointBuffers::getActiveBuffer();
+          Scheduler* previousScheduler = ElasticTeam::scheduler;
+          ElasticTeam::setScheduler(&localScheduler);
+
+          // round robin until all logical threads are finished
+          std::size_t nFinished = 0;
+          while (nFinished != fibers.size()) {
+            nFinished = 0;
+            for (Fiber* fiber : fibers) {
+              if (!fiber->isFinished) {
+                localScheduler.current = fiber;
+                swapcontext(&localScheduler.context, &fiber->context);
+              }
+              nFinished += fiber->isFinished;
+            }
+          }
+
+          ElasticTeam::setScheduler(previousScheduler);
+          AdjointBuffers::setActiveBuffer(adjointBuffer);
+          ReverseBarrier::leave(member);
+          tool->setThreadLocalTape(threadLocalTape);
+
+          for (Fiber* fiber : fibers) {
+            RecyclingPool<Fiber>::recycle(fiber);
+          }
+        #else
+          OPDI_UNUSED(job);
+          OPDI_UNUSED(jobData);
+          OPDI_UNUSED(size);
+          OPDI_UNUSED(threadNum);
+          OPDI_UNUSED(nThreads);
+          OPDI_ERROR("Elastic reverse teams are only supported on Linux.");
+        #endif
+      }
+
+      // whether the current thread runs logical threads
+      static bool isRunning() {
+        return ElasticTeam::scheduler != nullptr;
+      }
+
+      // waits of the current thread block instead of yielding until resume is called, e.g., in nested parallel regions
+      // nested parallel regions of logical threads still run on the fiber stack of OPDI_ELASTIC_REVERSE_TEAM_STACK_SIZE
+      static void* suspend() {
+        Scheduler* previousScheduler = ElasticTeam::scheduler;
+        ElasticTeam::setScheduler(nullptr);
+        return static_cast<void*>(previousScheduler);
+      }
+
+      static void resume(void* previousScheduler) {
+        ElasticTeam::setScheduler(static_cast<Scheduler*>(previousScheduler));
+      }
+
+      // deletes the recycled fibers
+      // not thread-safe! only use outside of parallel regions
+      static void clear() {
+        RecyclingPool<Fiber>::clear();
+      }
+  };
+}
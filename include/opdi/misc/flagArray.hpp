@@ -0,0 +1,96 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace opdi {
+
+  // array of atomic flags that grows on access
+  // growing is lock-free and does not move flags, references to them remain valid
+  struct FlagArray {
+    private:
+
+      using Flag = std::atomic<bool>;
+
+      // chunk c holds 2^c flags
+      static std::size_t constexpr nChunks = 8 * sizeof(std::size_t);
+
+      std::array<std::atomic<Flag*>, nChunks> chunks;
+
+    public:
+
+      FlagArray() {
+        for (auto& chunk : this->chunks) {
+          chunk.store(nullptr);
+        }
+      }
+
+      ~FlagArray() {
+        for (auto& chunk : this->chunks) {
+          delete[] chunk.load();
+        }
+      }
+
+      FlagArray(FlagArray const&) = delete;
+      FlagArray& operator=(FlagArray const&) = delete;
+
+      Flag& operator[](std::size_t index) {
+        std::size_t c = 0;
+        while (((index + 1) >> (c + 1)) != 0) {
+          ++c;
+        }
+
+        Flag* chunk = this->chunks[c].load();
+        if (chunk == nullptr) {
+          Flag* newChunk = new Flag[std::size_t(1) << c]();
+          if (this->chunks[c].compare_exchange_strong(chunk, newChunk)) {
+            chunk = newChunk;
+          }
+          else {
+            delete[] newChunk;  // chunk was set by another thread
+          }
+        }
+
+        return chunk[index + 1 - (std::size_t(1) << c)];
+      }
+
+      // sets all flags to false, keeps the memory
+      // not thread-safe! only use while the array is not accessed otherwise
+      void reset() {
+        for (std::size_t c = 0; c < nChunks; ++c) {
+          Flag* chunk = this->chunks[c].load();
+          if (chunk != nullptr) {
+            for (std::size_t i = 0; i < (std::size_t(1) << c); ++i) {
+              chunk[i].store(false);
+            }
+          }
+        }
+      }
+  };
+}
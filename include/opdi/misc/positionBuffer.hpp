@@ -0,0 +1,101 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace opdi {
+
+  // stores tape positions contiguously in a growable byte array
+  // positions must be trivially copyable, pointers to them are invalidated by push_back
+  struct PositionBuffer {
+    private:
+
+      static std::size_t constexpr alignment = alignof(std::max_align_t);
+
+      // each position occupies a whole number of blocks to keep it aligned
+      struct alignas(alignment) Block {
+        public:
+          char bytes[alignment];
+      };
+
+      std::vector<Block> blocks;
+      std::size_t blocksPerPosition;
+      std::size_t count;
+
+    public:
+
+      PositionBuffer() : blocks(), blocksPerPosition(0), count(0) {}
+
+      // keeps the allocated memory
+      void clear() {
+        this->count = 0;
+      }
+
+      void setPositionSize(std::size_t positionSize) {
+        assert(this->count == 0);
+        this->blocksPerPosition = std::max<std::size_t>(1, (positionSize + alignment - 1) / alignment);
+      }
+
+      std::size_t size() const {
+        return this->count;
+      }
+
+      bool empty() const {
+        return this->count == 0;
+      }
+
+      void* operator[](std::size_t i) {
+        assert(i < this->count);
+        return static_cast<void*>(&this->blocks[i * this->blocksPerPosition]);
+      }
+
+      void* front() {
+        return (*this)[0];
+      }
+
+      void* back() {
+        return (*this)[this->count - 1];
+      }
+
+      // appends an uninitialized position and returns it
+      void* push_back() {
+        ++this->count;
+        if (this->blocks.size() < this->count * this->blocksPerPosition) {
+          this->blocks.resize(this->count * this->blocksPerPosition);
+        }
+        return this->back();
+      }
+
+      void pop_back() {
+        assert(this->count > 0);
+        --this->count;
+      }
+  };
+}
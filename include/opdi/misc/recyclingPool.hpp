@@ -0,0 +1,107 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "../config.hpp"
+
+namespace opdi {
+
+  // recycles objects of type T together with the memory held by their members, e.g., the capacity of containers
+  // recycled objects are kept in thread-local lists and are handed out again without reinitialization
+  template<typename T>
+  struct RecyclingPool {
+    private:
+
+      struct Cache {
+        public:
+          std::vector<T*> objects;
+          Cache* next;
+
+          Cache() : objects(), next(nullptr) {}
+      };
+
+      static Cache* localCache;
+      #pragma omp threadprivate(localCache)
+
+      // all caches, list is only appended to in parallel
+      static std::atomic<Cache*> caches;
+
+      static Cache& getLocalCache() {
+        if (RecyclingPool::localCache == nullptr) {
+          Cache* cache = new Cache;
+          cache->next = RecyclingPool::caches.load();
+          while (!RecyclingPool::caches.compare_exchange_weak(cache->next, cache)) {}
+          RecyclingPool::localCache = cache;
+        }
+        return *RecyclingPool::localCache;
+      }
+
+    public:
+
+      static T* get() {
+        #if OPDI_RECYCLE_LOGIC_DATA
+          Cache& cache = RecyclingPool::getLocalCache();
+          if (!cache.objects.empty()) {
+            T* object = cache.objects.back();
+            cache.objects.pop_back();
+            return object;
+          }
+        #endif
+
+        return new T;
+      }
+
+      // may be called by threads other than the one that obtained the object
+      static void recycle(T* object) {
+        #if OPDI_RECYCLE_LOGIC_DATA
+          RecyclingPool::getLocalCache().objects.push_back(object);
+        #else
+          delete object;
+        #endif
+      }
+
+      // deletes all recycled objects
+      // not thread-safe! only use outside parallel regions
+      static void clear() {
+        for (Cache* cache = RecyclingPool::caches.load(); cache != nullptr; cache = cache->next) {
+          for (T* object : cache->objects) {
+            delete object;
+          }
+          cache->objects.clear();
+          cache->objects.shrink_to_fit();
+        }
+      }
+  };
+
+  template<typename T>
+  typename RecyclingPool<T>::Cache* RecyclingPool<T>::localCache = nullptr;
+
+  template<typename T>
+  std::atomic<typename RecyclingPool<T>::Cache*> RecyclingPool<T>::caches(nullptr);
+}
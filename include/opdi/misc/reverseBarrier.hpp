@@ -0,0 +1,168 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "../config.hpp"
+
+#include "waitPolicy.hpp"
+
+namespace opdi {
+
+  // barrier among the threads of a team in the reverse pass, replaces the barrier of the OpenMP runtime
+  // OPDI_REVERSE_BARRIER_CENTRAL uses a shared counter, OPDI_REVERSE_BARRIER_DISSEMINATION signals in log2(size) rounds
+  // without any shared counter
+  struct ReverseBarrier {
+    public:
+
+      // registration of a thread with a barrier
+      struct Member {
+        public:
+          ReverseBarrier* barrier;
+          int threadNum;
+      };
+
+    private:
+
+      struct alignas(64) Flag {
+        public:
+          std::atomic<std::size_t> value;
+      };
+
+      struct alignas(64) Episode {
+        public:
+          std::size_t value;  // number of barriers passed by the thread
+      };
+
+      int size;
+      int nRounds;
+
+      // dissemination, flag of thread i in round k at index i * nRounds + k
+      std::vector<Flag> flags;
+      std::vector<Episode> episodes;
+
+      // central
+      Flag nArrived;
+      Flag generation;
+
+      static Member member;
+      #pragma omp threadprivate(member)
+
+      void waitCentral() {
+        std::size_t currentGeneration = this->generation.value.load();
+
+        if (this->nArrived.value.fetch_add(1) + 1 == static_cast<std::size_t>(this->size)) {
+          this->nArrived.value.store(0);
+          this->generation.value.fetch_add(1);
+          WaitPolicy::notify<OPDI_REVERSE_BARRIER_WAIT_POLICY>(&this->generation.value);
+        }
+        else {
+          WaitPolicy::wait<OPDI_REVERSE_BARRIER_WAIT_POLICY>(&this->generation.value, [&]() {
+            return this->generation.value.load() != currentGeneration;
+          });
+        }
+      }
+
+      void waitDissemination(int threadNum) {
+        std::size_t episode = ++this->episodes[threadNum].value;
+
+        for (int round = 0, distance = 1; round < this->nRounds; ++round, distance *= 2) {
+          std::atomic<std::size_t>& partnerFlag =
+              this->flags[((threadNum + distance) % this->size) * this->nRounds + round].value;
+          partnerFlag.fetch_add(1);
+          WaitPolicy::notify<OPDI_REVERSE_BARRIER_WAIT_POLICY>(&partnerFlag);
+
+          // exactly one thread signals this flag per episode
+          std::atomic<std::size_t>& ownFlag = this->flags[threadNum * this->nRounds + round].value;
+          WaitPolicy::wait<OPDI_REVERSE_BARRIER_WAIT_POLICY>(&ownFlag, [&]() {
+            return ownFlag.load() >= episode;
+          });
+        }
+      }
+
+    public:
+
+      ReverseBarrier() : size(0), nRounds(0), flags(), episodes(), nArrived(), generation() {}
+
+      // prepares the barrier for a team of the given size
+      // not thread-safe! only use before the threads of the team use the barrier
+      void resize(int size) {
+        this->size = size;
+
+        this->nRounds = 0;
+        while ((1 << this->nRounds) < size) {
+          ++this->nRounds;
+        }
+
+        #if OPDI_REVERSE_BARRIER == OPDI_REVERSE_BARRIER_DISSEMINATION
+          // atomics cannot be copied, hence the vectors are only replaced if the size changes
+          if (this->episodes.size() != static_cast<std::size_t>(size)) {
+            this->flags = std::vector<Flag>(size * this->nRounds);
+            this->episodes = std::vector<Episode>(size);
+          }
+          for (Flag& flag : this->flags) {
+            flag.value.store(0);
+          }
+          for (Episode& episode : this->episodes) {
+            episode.value = 0;
+          }
+        #endif
+
+        this->nArrived.value.store(0);
+        this->generation.value.store(0);
+      }
+
+      // registers the calling thread as the thread with the given number in the team of the barrier
+      // returns the previous registration, which has to be restored by leave
+      static Member enter(ReverseBarrier* barrier, int threadNum) {
+        Member previous = ReverseBarrier::member;
+        ReverseBarrier::member.barrier = barrier;
+        ReverseBarrier::member.threadNum = threadNum;
+        return previous;
+      }
+
+      static void leave(Member const& previous) {
+        ReverseBarrier::member = previous;
+      }
+
+      // whether the calling thread is registered with a barrier
+      static bool isMember() {
+        return ReverseBarrier::member.barrier != nullptr;
+      }
+
+      // must be called by all threads of the team
+      static void wait() {
+        #if OPDI_REVERSE_BARRIER == OPDI_REVERSE_BARRIER_DISSEMINATION
+          ReverseBarrier::member.barrier->waitDissemination(ReverseBarrier::member.threadNum);
+        #else
+          ReverseBarrier::member.barrier->waitCentral();
+        #endif
+      }
+  };
+}
@@ -0,0 +1,172 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <omp.h>
+#include <thread>
+#include <vector>
+
+#include "../config.hpp"
+
+#include "waitPolicy.hpp"
+
+namespace opdi {
+
+  // team of threads that persists across the parallel regions of a tape evaluation
+  // the thread that begins the evaluation takes part in each job as thread 0, the other threads are started on demand
+  struct ReverseTeam {
+    public:
+      typedef void (*Job) (void* data, int threadNum);
+
+    private:
+
+      static std::vector<std::thread> workers;
+
+      // current job, published by incrementing the generation
+      static Job job;
+      static void* jobData;
+      static int jobSize;
+      static bool stopping;
+      static std::atomic<std::size_t> generation;
+      static std::atomic<int> nFinished;
+
+      // barrier among the threads of the current job
+      static std::atomic<int> nArrived;
+      static std::atomic<std::size_t> barrierGeneration;
+
+      static bool isOwner;  // whether this thread began the evaluation
+      static int jobLevel;  // nesting level at which this thread executes a job, -1 if it does not
+      #pragma omp threadprivate(isOwner, jobLevel)
+
+      static void execute(int threadNum) {
+        ReverseTeam::jobLevel = omp_get_level();
+        ReverseTeam::job(ReverseTeam::jobData, threadNum);
+        ReverseTeam::jobLevel = -1;
+      }
+
+      static void work(int threadNum, std::size_t seenGeneration) {
+        ReverseTeam::jobLevel = -1;
+
+        while (true) {
+          WaitPolicy::wait<OPDI_REVERSE_TEAM_WAIT_POLICY>(&ReverseTeam::generation, [&]() {
+            return ReverseTeam::generation.load() != seenGeneration;
+          });
+          seenGeneration = ReverseTeam::generation.load();
+
+          if (ReverseTeam::stopping) {
+            return;
+          }
+
+          if (threadNum < ReverseTeam::jobSize) {
+            ReverseTeam::execute(threadNum);
+
+            ReverseTeam::nFinished.fetch_add(1);
+            WaitPolicy::notify<OPDI_REVERSE_TEAM_WAIT_POLICY>(&ReverseTeam::nFinished);
+          }
+        }
+      }
+
+      static void publish() {
+        ReverseTeam::generation.fetch_add(1);
+        WaitPolicy::notify<OPDI_REVERSE_TEAM_WAIT_POLICY>(&ReverseTeam::generation);
+      }
+
+    public:
+
+      // not thread-safe! only use outside of parallel regions
+      static void beginEvaluation() {
+        ReverseTeam::isOwner = true;
+      }
+
+      // not thread-safe! only use outside of parallel regions
+      static void endEvaluation() {
+        ReverseTeam::isOwner = false;
+      }
+
+      // whether parallel regions encountered by this thread are evaluated by the team
+      static bool canRun() {
+        return ReverseTeam::isOwner && ReverseTeam::jobLevel == -1 && omp_get_level() == 0;
+      }
+
+      // whether this thread currently executes a job of the team, and not a nested parallel region thereof
+      static bool isMember() {
+        return ReverseTeam::jobLevel != -1 && ReverseTeam::jobLevel == omp_get_level();
+      }
+
+      // executes the job on size threads, returns after all of them have finished
+      static void run(Job job, void* data, int size) {
+
+        while (static_cast<int>(ReverseTeam::workers.size()) < size - 1) {
+          ReverseTeam::workers.emplace_back(ReverseTeam::work, static_cast<int>(ReverseTeam::workers.size()) + 1,
+                                            ReverseTeam::generation.load());
+        }
+
+        ReverseTeam::job = job;
+        ReverseTeam::jobData = data;
+        ReverseTeam::jobSize = size;
+        ReverseTeam::nFinished.store(0);
+        ReverseTeam::publish();
+
+        ReverseTeam::execute(0);
+
+        WaitPolicy::wait<OPDI_REVERSE_TEAM_WAIT_POLICY>(&ReverseTeam::nFinished, [&]() {
+          return ReverseTeam::nFinished.load() == size - 1;
+        });
+      }
+
+      // must be called by all threads of the current job
+      static void barrier() {
+        std::size_t currentGeneration = ReverseTeam::barrierGeneration.load();
+
+        if (ReverseTeam::nArrived.fetch_add(1) + 1 == ReverseTeam::jobSize) {
+          ReverseTeam::nArrived.store(0);
+          ReverseTeam::barrierGeneration.fetch_add(1);
+          WaitPolicy::notify<OPDI_REVERSE_TEAM_WAIT_POLICY>(&ReverseTeam::barrierGeneration);
+        }
+        else {
+          WaitPolicy::wait<OPDI_REVERSE_TEAM_WAIT_POLICY>(&ReverseTeam::barrierGeneration, [&]() {
+            return ReverseTeam::barrierGeneration.load() != currentGeneration;
+          });
+        }
+      }
+
+      // joins all threads of the team
+      // not thread-safe! only use outside of parallel regions
+      static void finalize() {
+        ReverseTeam::stopping = true;
+        ReverseTeam::publish();
+
+        for (auto& worker : ReverseTeam::workers) {
+          worker.join();
+        }
+
+        ReverseTeam::workers.clear();
+        ReverseTeam::stopping = false;
+      }
+  };
+}
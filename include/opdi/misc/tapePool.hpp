@@ -26,8 +26,8 @@
 #pragma once
 
 #include <omp.h>
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "../tool/toolInterface.hpp"
 
@@ -35,11 +35,26 @@ namespace opdi {
 
   struct TapePool {
     private:
-      std::map<void*, std::map<int, void*>> tapes;
-      std::set<void*> createdTapes;
+      using Tapes = std::vector<void*>;  // indexed by thread number
+
+      std::unordered_map<void*, Tapes> tapes;  // references to elements remain valid upon insertion
 
       omp_lock_t lock;
 
+      // tapes of the most recent encountering task tape, cached per thread
+      static void* cachedEncounteringTaskTape;
+      static Tapes* cachedTapes;
+      static std::size_t localCacheGeneration;
+      #pragma omp threadprivate(cachedEncounteringTaskTape, cachedTapes, localCacheGeneration)
+
+      static std::size_t cacheGeneration;
+
+      static void grow(Tapes& tapes, int sizeOfTeam) {
+        while (tapes.size() < static_cast<std::size_t>(sizeOfTeam)) {
+          tapes.push_back(tool->createTape());
+        }
+      }
+
     public:
 
       TapePool() {}
@@ -48,6 +63,9 @@ namespace opdi {
 
       void init() {
         omp_init_lock(&this->lock);
+
+        // tapes cached for a previous pool must not be used
+        ++TapePool::cacheGeneration;
       }
 
       void finalize() {
@@ -59,28 +77,60 @@ namespace opdi {
         return &this->lock;
       }
 
-      void* getTape(void* encounteringTaskTape, int index) {
-        omp_set_lock(&this->lock);
+      // returns at least sizeOfTeam tapes for the children of the encountering task tape
+      // must only be called by the thread that records on the encountering task tape
+      // the result is only valid until the next call for the same encountering task tape
+      void* const* getTapes(void* encounteringTaskTape, int sizeOfTeam) {
+
+        if (TapePool::localCacheGeneration != TapePool::cacheGeneration ||
+            TapePool::cachedEncounteringTaskTape != encounteringTaskTape) {
+          omp_set_lock(&this->lock);
+          TapePool::cachedTapes = &this->tapes[encounteringTaskTape];
+          omp_unset_lock(&this->lock);
 
-        if (this->tapes[encounteringTaskTape].find(index) == this->tapes[encounteringTaskTape].end()) {
-          void* newTape = tool->createTape();
-          this->tapes[encounteringTaskTape][index] = newTape;
-          this->createdTapes.insert(newTape);
+          TapePool::cachedEncounteringTaskTape = encounteringTaskTape;
+          TapePool::localCacheGeneration = TapePool::cacheGeneration;
         }
 
-        void* result = this->tapes[encounteringTaskTape][index];
-        omp_unset_lock(&this->lock);
-        return result;
+        Tapes& tapes = *TapePool::cachedTapes;
+
+        // other threads do not access this entry, the lock serializes tape creation only
+        if (tapes.size() < static_cast<std::size_t>(sizeOfTeam)) {
+          omp_set_lock(&this->lock);
+          TapePool::grow(tapes, sizeOfTeam);
+          omp_unset_lock(&this->lock);
+        }
+
+        return tapes.data();
       }
 
+      // creates tapes for nestingDepth levels of nested parallel regions with sizeOfTeam threads each
+      // not thread-safe! only use outside of parallel regions
+      void reserve(void* encounteringTaskTape, int nestingDepth, int sizeOfTeam, std::size_t expectedTapeSize) {
+
+        if (nestingDepth <= 0) {
+          return;
+        }
+
+        Tapes& tapes = this->tapes[encounteringTaskTape];
+        TapePool::grow(tapes, sizeOfTeam);
+
+        for (int i = 0; i < sizeOfTeam; ++i) {
+          tool->reserveTape(tapes[i], expectedTapeSize);
+          this->reserve(tapes[i], nestingDepth - 1, sizeOfTeam, expectedTapeSize);
+        }
+      }
+
+      // not thread-safe! only use outside of parallel regions
       void clear() {
-        omp_set_lock(&this->lock);
-        for (auto& tape : this->createdTapes) {
-          tool->deleteTape(tape);
+        for (auto& pair : this->tapes) {
+          for (auto& tape : pair.second) {
+            tool->deleteTape(tape);
+          }
         }
-        this->createdTapes.clear();
         this->tapes.clear();
-        omp_unset_lock(&this->lock);
+
+        ++TapePool::cacheGeneration;
       }
   };
 }
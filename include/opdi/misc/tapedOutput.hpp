@@ -29,6 +29,7 @@
 
 #include "../tool/toolInterface.hpp"
 
+#include "blockPool.hpp"
 #include "output.hpp"
 
 namespace opdi {
@@ -44,7 +45,7 @@ namespace opdi {
         TapedOutput::setActive(false);
       }
 
-      struct ReversePrintData {
+      struct ReversePrintData : public BlockPoolObject {
         public:
           std::string message;
       };
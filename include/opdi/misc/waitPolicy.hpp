@@ -0,0 +1,159 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#ifdef __linux__
+  #include <climits>
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+#include "../config.hpp"
+#include "../helpers/macros.hpp"
+
+namespace opdi {
+
+  // strategies for threads that wait until a condition on some shared memory is satisfied
+  struct WaitPolicy {
+    public:
+
+      using Yield = void (*)();
+
+    private:
+
+      // set while the thread runs cooperatively scheduled logical threads, waits yield to them instead of blocking
+      static Yield yield;
+      #pragma omp threadprivate(yield)
+
+      // waiters on addresses with the same hash park on the same bucket
+      struct alignas(64) Bucket {
+        public:
+          std::atomic<std::uint32_t> sequence;  // incremented on each notification
+          std::atomic<std::uint32_t> nWaiters;  // number of parked or about to be parked threads
+      };
+
+      static std::size_t constexpr nBuckets = 256;
+
+      static std::array<Bucket, nBuckets> buckets;
+
+      static Bucket& getBucket(void const* address) {
+        std::uintptr_t value = reinterpret_cast<std::uintptr_t>(address);
+        return WaitPolicy::buckets[((value >> 6) ^ (value >> 14)) % nBuckets];
+      }
+
+      static void park(Bucket& bucket, std::uint32_t sequence) {
+        #ifdef __linux__
+          syscall(SYS_futex, &bucket.sequence, FUTEX_WAIT_PRIVATE, sequence, nullptr, nullptr, 0);
+        #else
+          OPDI_UNUSED(bucket);
+          OPDI_UNUSED(sequence);
+          std::this_thread::yield();
+        #endif
+      }
+
+      static void unpark(Bucket& bucket) {
+        #ifdef __linux__
+          syscall(SYS_futex, &bucket.sequence, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+        #else
+          OPDI_UNUSED(bucket);
+        #endif
+      }
+
+    public:
+
+      // busy waits, optionally yields or parks the thread after OPDI_WAIT_SPIN_COUNT unsuccessful checks
+      // memory that is waited on with OPDI_WAIT_SPIN_PARK must be modified by threads that call notify afterwards
+      template<int policy, typename Condition>
+      static void wait(void const* address, Condition const& isSatisfied) {
+
+        #if OPDI_ELASTIC_REVERSE_TEAM
+          if (WaitPolicy::yield != nullptr) {
+            while (!isSatisfied()) {
+              WaitPolicy::yield();
+            }
+            return;
+          }
+        #endif
+
+        if (policy != OPDI_WAIT_SPIN) {
+          for (int i = 0; i < OPDI_WAIT_SPIN_COUNT; ++i) {
+            if (isSatisfied()) {
+              return;
+            }
+          }
+        }
+
+        if (policy == OPDI_WAIT_SPIN_PARK) {
+          Bucket& bucket = WaitPolicy::getBucket(address);
+
+          while (true) {
+            // register as waiter before the condition is checked, so that no notification is missed
+            bucket.nWaiters.fetch_add(1);
+            std::uint32_t sequence = bucket.sequence.load();
+
+            if (isSatisfied()) {
+              bucket.nWaiters.fetch_sub(1);
+              return;
+            }
+
+            // returns immediately if there was a notification in the meantime
+            WaitPolicy::park(bucket, sequence);
+            bucket.nWaiters.fetch_sub(1);
+          }
+        }
+        else {
+          while (!isSatisfied()) {
+            if (policy == OPDI_WAIT_SPIN_YIELD) {
+              std::this_thread::yield();
+            }
+          }
+        }
+      }
+
+      // wakes threads that wait on the given address, if there are any
+      template<int policy>
+      static void notify(void const* address) {
+        if (policy == OPDI_WAIT_SPIN_PARK) {
+          Bucket& bucket = WaitPolicy::getBucket(address);
+          bucket.sequence.fetch_add(1);
+
+          if (bucket.nWaiters.load() != 0) {
+            WaitPolicy::unpark(bucket);
+          }
+        }
+      }
+
+      static void setYield(Yield yield) {
+        WaitPolicy::yield = yield;
+      }
+  };
+}
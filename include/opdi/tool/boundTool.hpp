@@ -0,0 +1,61 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+
+#include "toolInterface.hpp"
+
+/* If OPDI_STATIC_TOOL is defined to a concrete tool type, e.g., CoDiOpDiLibTool<Real>, the logic accesses the tool
+ * through a final class derived from it. Calls into the tool can then be bound at compile time and inlined. The tool
+ * must be created as opdi::BoundTool and the type must be complete wherever this file is included, which is the case in
+ * opdi.cpp if it is included after the tool type has been declared.
+ *
+ * Otherwise, the tool is accessed through the virtual ToolInterface.
+ */
+
+namespace opdi {
+
+#ifdef OPDI_STATIC_TOOL
+
+  struct BoundTool final : public OPDI_STATIC_TOOL {
+    public:
+      // the macro might expand to a qualified name or a template-id, which cannot name inherited constructors
+      using Base = OPDI_STATIC_TOOL;
+      using Base::Base;
+  };
+
+#else
+
+  using BoundTool = ToolInterface;
+
+#endif
+
+  inline BoundTool* boundTool() {
+    assert(dynamic_cast<BoundTool*>(tool) == tool);  // tool must be an opdi::BoundTool
+    return static_cast<BoundTool*>(tool);
+  }
+}
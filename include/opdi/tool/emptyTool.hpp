@@ -131,6 +131,11 @@ namespace opdi {
         OPDI_UNUSED(handle);
       }
 
+      void pushInlineExternalFunction(void* tape, InlineHandle const& inlineHandle) {
+        OPDI_UNUSED(tape);
+        OPDI_UNUSED(inlineHandle);
+      }
+
       // tape editing
 
       void erase(void* tape, void* start, void* end) {
@@ -25,9 +25,11 @@
 
 #pragma once
 
+#include "../../misc/blockPool.hpp"
+
 namespace opdi {
 
-  struct Handle {
+  struct Handle : public BlockPoolObject {
     public:
       typedef void (*Callback) (void*);
     
@@ -36,5 +38,8 @@ namespace opdi {
       Callback deleteFunc;
 
       Handle() : data(nullptr), reverseFunc(nullptr), deleteFunc(nullptr) {}
+
+      // tools delete handles via pointers to this base, derived handles are deallocated with their actual size
+      virtual ~Handle() {}
   };
 }
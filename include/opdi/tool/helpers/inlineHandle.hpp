@@ -0,0 +1,75 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "../../misc/blockPool.hpp"
+
+#include "handle.hpp"
+
+namespace opdi {
+
+  // handle that stores small, trivially copyable data by value
+  // the tool may copy the handle into its tape, the data must not refer to the handle's own address
+  struct InlineHandle : public BlockPoolObject {
+    public:
+      typedef void (*Callback) (void*);
+
+      static std::size_t constexpr capacity = 4 * sizeof(void*);
+
+      alignas(void*) char data[capacity];
+      Callback reverseFunc;
+
+      InlineHandle() : data(), reverseFunc(nullptr) {}
+
+      template<typename Data>
+      void setData(Data const& value) {
+        static_assert(std::is_trivially_copyable<Data>::value, "Inline data must be trivially copyable.");
+        static_assert(sizeof(Data) <= capacity, "Inline data exceeds the capacity of the handle.");
+        static_assert(alignof(Data) <= alignof(void*), "Inline data is over-aligned.");
+
+        std::memcpy(this->data, &value, sizeof(Data));
+      }
+  };
+
+  // regular handle that embeds a copy of an inline handle, for tools that do not store inline handles by value
+  // data and callbacks refer to the embedded copy, hence it is created and deleted with a single allocation
+  struct InlineHandleWrapper : public Handle {
+    public:
+      InlineHandle inlineHandle;
+
+      InlineHandleWrapper(InlineHandle const& inlineHandle) : Handle(), inlineHandle(inlineHandle) {
+        this->data = static_cast<void*>(this->inlineHandle.data);
+        this->reverseFunc = this->inlineHandle.reverseFunc;
+        this->deleteFunc = InlineHandleWrapper::emptyDeleteFunc;  // the data is deleted together with the handle
+      }
+
+      static void emptyDeleteFunc(void*) {}
+  };
+}
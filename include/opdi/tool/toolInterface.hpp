@@ -25,15 +25,23 @@
 
 #pragma once
 
+#include <limits>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "../helpers/macros.hpp"
 
 #include "helpers/handle.hpp"
+#include "helpers/inlineHandle.hpp"
 
 namespace opdi {
   
   struct ToolInterface {
     public:
 
+      using AdjointRange = std::pair<std::size_t, std::size_t>;  // identifiers first, ..., second - 1
+
       virtual ~ToolInterface() {}
 
       // initialization and finalization
@@ -51,6 +59,7 @@ namespace opdi {
       virtual void setThreadLocalTape(void* tape) = 0;
 
       // position handling
+      // positions must be trivially copyable, OpDiLib may store them in its own buffers of getPositionSize() bytes
 
       virtual void* allocPosition() = 0;
       virtual void freePosition(void* position) = 0;
@@ -69,9 +78,81 @@ namespace opdi {
       virtual void evaluate(void* tape, void* start, void* end, bool useAtomics = true) = 0;
       virtual void reset(void* tape, bool clearAdjoints = true) = 0;
       virtual void reset(void* tape, void* position, bool clearAdjoints = true) = 0;
+
+      // whether disjoint ranges of the same tape may be evaluated by several threads at the same time
+      // required for loop work stealing in the reverse pass, tools that do not support this return false
+      virtual bool supportsConcurrentEvaluation() {
+        return false;
+      }
+
+      // hint that the tape will record about the given number of statements, tools may preallocate memory
+      virtual void reserveTape(void* tape, std::size_t expectedTapeSize) {
+        OPDI_UNUSED(tape);
+        OPDI_UNUSED(expectedTapeSize);
+      }
+
+      // number of statements recorded between two positions, tools that cannot tell may keep the maximum
+      virtual std::size_t getStatementCount(void* tape, void* start, void* end) {
+        OPDI_UNUSED(tape);
+        OPDI_UNUSED(start);
+        OPDI_UNUSED(end);
+        return std::numeric_limits<std::size_t>::max();
+      }
+
+      // identifiers whose adjoints an evaluation of the tape range would read and update, appended to the vectors
+      // used for analysis purposes only, tools that do not support this return false
+      virtual bool getAdjointAccesses(void* tape, void* start, void* end, std::vector<std::size_t>& read,
+                                      std::vector<std::size_t>& updated) {
+        OPDI_UNUSED(tape);
+        OPDI_UNUSED(start);
+        OPDI_UNUSED(end);
+        OPDI_UNUSED(read);
+        OPDI_UNUSED(updated);
+        return false;
+      }
+
+      // like evaluate with atomics, but adjoints in the sorted, disjoint ranges are updated without atomics
+      virtual void evaluateOwned(void* tape, void* start, void* end, AdjointRange const* ownedAdjoints,
+                                 std::size_t nOwnedAdjoints) {
+        OPDI_UNUSED(ownedAdjoints);
+        OPDI_UNUSED(nOwnedAdjoints);
+        this->evaluate(tape, start, end, true);
+      }
+
+      // adjoint buffers collect the adjoint updates of one thread in the reverse pass, they may be dense or sparse
+      // tools that return nullptr do not support privatized adjoint access, atomic updates are used instead
+      virtual void* createAdjointBuffer() {
+        return nullptr;
+      }
+
+      virtual void deleteAdjointBuffer(void* buffer) {
+        OPDI_UNUSED(buffer);
+      }
+
+      // like evaluate, but adjoint updates go to the buffer, adjoints are read as the sum of global and buffered ones
+      virtual void evaluatePrivatized(void* tape, void* start, void* end, void* buffer) {
+        OPDI_UNUSED(buffer);
+        this->evaluate(tape, start, end, true);
+      }
+
+      // adds the buffered adjoints to the global adjoints and clears the buffers
+      // called concurrently for part = 0, ..., nParts - 1, each call has to treat a disjoint set of adjoints
+      // atomic updates are requested if other threads might update the global adjoints at the same time
+      virtual void mergeAdjointBuffers(void* const* buffers, int nBuffers, int part, int nParts, bool useAtomics) {
+        OPDI_UNUSED(buffers);
+        OPDI_UNUSED(nBuffers);
+        OPDI_UNUSED(part);
+        OPDI_UNUSED(nParts);
+        OPDI_UNUSED(useAtomics);
+      }
       
       virtual void pushExternalFunction(void* tape, Handle const* handle) = 0;
 
+      // tools may override this to store the inline handle by value, the default wraps it into a regular handle
+      virtual void pushInlineExternalFunction(void* tape, InlineHandle const& inlineHandle) {
+        this->pushExternalFunction(tape, new InlineHandleWrapper(inlineHandle));
+      }
+
       // tape editing
 
       virtual void erase(void* tape, void* start, void* end) = 0;
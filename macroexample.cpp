@@ -59,6 +59,7 @@ int main(int nargs, char** args) {
 
   OPDI_PARALLEL()
   {
+    // accumulates over all iterations of the thread, which therefore must not be split by OPDI_LOOP_CHUNK
     Real localSum = 0.0;
 
     OPDI_FOR()
@@ -62,6 +62,7 @@ int main(int nargs, char** args) {
 
   #pragma omp parallel
   {
+    // accumulates over all iterations of the thread, which therefore must form a single chunk, as with this schedule
     Real localSum = 0.0;
 
     #pragma omp for
@@ -51,6 +51,11 @@
 using TestReal = codi::RealForward;
 
 #ifndef BUILD_REFERENCE
+  #ifdef STATIC_TOOL
+    #define OPDI_STATIC_TOOL opdi::EmptyTool
+  #endif
+  #include "opdi/tool/boundTool.hpp"
+
   OPDI_DECLARE_REDUCTION(+, TestReal, +, 0.0);
   OPDI_DECLARE_REDUCTION(*, TestReal, *, 1.0);
 #endif
@@ -78,7 +83,11 @@ struct DriverFirstOrderForward : public DriverBase<DriverFirstOrderForward<_Case
         #endif
         opdi::logic = new opdi::OmpLogic;
         opdi::logic->init();
-        opdi::tool = new opdi::EmptyTool;  // EmptyTool effectively deactivates OpDiLib
+        #ifdef OPDI_STATIC_TOOL
+          opdi::tool = new opdi::BoundTool;  // bound EmptyTool, effectively deactivates OpDiLib
+        #else
+          opdi::tool = new opdi::EmptyTool;  // EmptyTool effectively deactivates OpDiLib
+        #endif
         opdi::tool->init();
       #endif
 
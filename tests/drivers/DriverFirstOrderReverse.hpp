@@ -46,12 +46,18 @@
 #endif
 
 #include "driverBase.hpp"
+#include "testTool.hpp"
 
 #ifdef BUILD_REFERENCE
   using TestReal = codi::RealReverseIndex;
 #else
   using TestReal = codi::RealReverseIndexOpenMPGen<double, double>;
 
+  #ifdef STATIC_TOOL
+    #define OPDI_STATIC_TOOL TestTool<TestReal>
+  #endif
+  #include "opdi/tool/boundTool.hpp"
+
   OPDI_DECLARE_REDUCTION(+, TestReal, +, 0.0);
   OPDI_DECLARE_REDUCTION(*, TestReal, *, 1.0);
 #endif
@@ -79,7 +85,11 @@ struct DriverFirstOrderReverse : public DriverBase<DriverFirstOrderReverse<_Case
         #endif
         opdi::logic = new opdi::OmpLogic;
         opdi::logic->init();
-        opdi::tool = new CoDiOpDiLibTool<TestReal>;
+        #ifdef OPDI_STATIC_TOOL
+          opdi::tool = new opdi::BoundTool;
+        #else
+          opdi::tool = new TestTool<TestReal>;
+        #endif
         opdi::tool->init();
       #endif
 
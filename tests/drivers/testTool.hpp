@@ -0,0 +1,109 @@
+/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+#ifndef BUILD_REFERENCE
+  #include <atomic>
+  #include <cassert>
+
+  // CoDiPack's tapes support the concurrent evaluation of disjoint ranges, this enables loop work stealing in the tests
+  // CoDiPack has no adjoint buffers, the test tool provides buffers that only check how OpDiLib uses them
+  // privatized parts are still evaluated with atomic updates, which yields the same adjoints
+  template<typename Real>
+  struct TestTool : public CoDiOpDiLibTool<Real> {
+    private:
+      struct AdjointBuffer {
+        public:
+          std::atomic<bool> hasUpdates = {false};
+          std::atomic<int> nMergedParts = {0};
+      };
+
+      // buffer and tape of the last privatized evaluation of this thread
+      static thread_local AdjointBuffer* lastBuffer;
+      static thread_local void* lastTape;
+
+    public:
+      bool supportsConcurrentEvaluation() {
+        return true;
+      }
+
+      void evaluate(void* tape, void* start, void* end, bool useAtomics = true) {
+        // the updates of later privatized parts must be merged before earlier parts are evaluated
+        assert(lastBuffer == nullptr || !lastBuffer->hasUpdates || lastTape != tape);
+
+        CoDiOpDiLibTool<Real>::evaluate(tape, start, end, useAtomics);
+      }
+
+      void* createAdjointBuffer() {
+        return new AdjointBuffer;
+      }
+
+      void deleteAdjointBuffer(void* buffer) {
+        AdjointBuffer* adjointBuffer = static_cast<AdjointBuffer*>(buffer);
+
+        // all updates must have been merged
+        assert(!adjointBuffer->hasUpdates);
+        assert(adjointBuffer->nMergedParts.load() == 0);
+
+        delete adjointBuffer;
+      }
+
+      void evaluatePrivatized(void* tape, void* start, void* end, void* buffer) {
+        AdjointBuffer* adjointBuffer = static_cast<AdjointBuffer*>(buffer);
+
+        // buffers must not be merged while they are in use
+        assert(adjointBuffer->nMergedParts.load() == 0);
+
+        CoDiOpDiLibTool<Real>::evaluate(tape, start, end, true);
+
+        adjointBuffer->hasUpdates = true;
+        lastBuffer = adjointBuffer;
+        lastTape = tape;
+      }
+
+      void mergeAdjointBuffers(void* const* buffers, int nBuffers, int part, int nParts, bool useAtomics) {
+        OPDI_UNUSED(useAtomics);
+
+        assert(nBuffers > 0);
+        assert(0 <= part && part < nParts);
+
+        // a buffer is merged completely once all parts have been merged
+        for (int i = 0; i < nBuffers; ++i) {
+          AdjointBuffer* adjointBuffer = static_cast<AdjointBuffer*>(buffers[i]);
+          if (adjointBuffer->nMergedParts.fetch_add(1) + 1 == nParts) {
+            adjointBuffer->hasUpdates = false;
+            adjointBuffer->nMergedParts.store(0);
+          }
+        }
+      }
+  };
+
+  template<typename Real>
+  thread_local typename TestTool<Real>::AdjointBuffer* TestTool<Real>::lastBuffer = nullptr;
+
+  template<typename Real>
+  thread_local void* TestTool<Real>::lastTape = nullptr;
+#endif
@@ -0,0 +1,146 @@
+﻿/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+#pragma once
+
+#include "testBase.hpp"
+
+template<typename _Case>
+struct TestAdjointAccessControlPrivatized : public TestBase<4, 1, 3, TestAdjointAccessControlPrivatized<_Case>> {
+  public:
+    using Case = _Case;
+    using Base = TestBase<4, 1, 3, TestAdjointAccessControlPrivatized<Case>>;
+
+    template<typename T>
+    static void test(std::array<T, Base::nIn> const& in, std::array<T, Base::nOut>& out) {
+
+      int const N = 100;
+      T* a = new T[N];
+      T* b = new T[N];
+      T* c = new T[N];
+
+      // note: these assertions are disabled for Primal and FirstOrderForward
+      assertAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Atomic);
+
+      OPDI_PARALLEL()
+      {
+        int outerNThreads = omp_get_num_threads();
+        int outerStart = ((N - 1) / outerNThreads + 1) * omp_get_thread_num();
+        int outerEnd = std::min(N, ((N - 1) / outerNThreads + 1) * (omp_get_thread_num() + 1));
+
+        // shared reading of in
+        for (int i = outerStart; i < outerEnd; ++i) {
+          Base::job1(i, in, a[i]);
+        }
+
+        #if _OPENMP
+          opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Privatized);
+        #endif
+
+        assertAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Privatized);
+
+        // shared reading of in, no values of other threads are used
+        for (int i = outerStart; i < outerEnd; ++i) {
+          T arg = a[i];
+          for (int k = 0; k < 10; ++k) {
+            arg += in[(i + k) % Base::nIn] * in[k % Base::nIn];
+          }
+          b[i] = sin(arg);
+        }
+
+        // nested region inside a privatized part
+        OPDI_PARALLEL()
+        {
+          assertAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Privatized);
+
+          int innerNThreads = omp_get_num_threads();
+          int innerStart = outerStart + (((outerEnd - outerStart) - 1) / innerNThreads + 1) * omp_get_thread_num();
+          int innerEnd = std::min(outerEnd, outerStart + (((outerEnd - outerStart) - 1) / innerNThreads + 1)
+                                                                                     * (omp_get_thread_num() + 1));
+
+          // shared reading of in and of values of the encountering thread
+          for (int j = innerStart; j < innerEnd; ++j) {
+            c[j] = cos(b[j] * in[j % Base::nIn] + b[outerStart]);
+          }
+        }
+        OPDI_END_PARALLEL
+
+        #if _OPENMP
+          opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Classical);
+        #endif
+
+        assertAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Classical);
+
+        // no shared reading
+        for (int i = outerStart; i < outerEnd; ++i) {
+          c[i] = exp(c[i]) * b[i];
+        }
+
+        #if _OPENMP
+          opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Atomic);
+        #endif
+
+        OPDI_BARRIER()
+
+        assertAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Atomic);
+
+        // shared reading on c
+        for (int i = outerStart; i < outerEnd; ++i) {
+          T arg = c[i];
+          for (int k = 1; k < 10; ++k) {
+            arg += c[(i + k) % N];
+          }
+          a[i] = cos(arg);
+        }
+
+        #if _OPENMP
+          opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Privatized);
+        #endif
+
+        // privatized part at the end of the region
+        for (int i = outerStart; i < outerEnd; ++i) {
+          a[i] *= in[i % Base::nIn];
+        }
+
+        #if _OPENMP
+          opdi::logic->setAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Atomic);
+        #endif
+      }
+      OPDI_END_PARALLEL
+
+      assertAdjointAccessMode(opdi::LogicInterface::AdjointAccessMode::Atomic);
+
+      for (int i = 0; i < N; ++i) {
+        out[0] += a[i];
+      }
+
+      delete [] a;
+      delete [] b;
+      delete [] c;
+    }
+};
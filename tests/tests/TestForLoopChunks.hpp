@@ -0,0 +1,74 @@
+﻿/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+#include "testBase.hpp"
+
+template<typename _Case>
+struct TestForLoopChunks : public TestBase<4, 1, 3, TestForLoopChunks<_Case>> {
+  public:
+    using Case = _Case;
+    using Base = TestBase<4, 1, 3, TestForLoopChunks<Case>>;
+
+    template<typename T>
+    static void test(std::array<T, Base::nIn> const& in, std::array<T, Base::nOut>& out) {
+
+      int const N = 100;
+      T* jobResults = new T[N];
+      T* loopResults = new T[N];
+
+      OPDI_PARALLEL()
+      {
+        /* unbalanced chunks, later iterations take longer */
+        OPDI_FOR(schedule(dynamic, 1))
+        for (int i = 0; i < N; ++i) {
+          OPDI_LOOP_CHUNK
+          Base::job1(i, in, jobResults[i]);
+          for (int k = 0; k < 250 + 5 * i; ++k) {
+            jobResults[i] = sin(jobResults[i]) + in[k % 4];
+          }
+        }
+        OPDI_END_FOR
+
+        /* chunks access the results of other chunks */
+        OPDI_FOR(schedule(static, 5))
+        for (int i = 0; i < N; ++i) {
+          OPDI_LOOP_CHUNK
+          loopResults[i] = cos(exp(jobResults[i])) * jobResults[(i + 37) % N];
+        }
+        OPDI_END_FOR
+      }
+      OPDI_END_PARALLEL
+
+      for (int i = 0; i < N; ++i) {
+        out[0] += loopResults[i];
+      }
+
+      delete [] jobResults;
+      delete [] loopResults;
+    }
+};
@@ -0,0 +1,111 @@
+﻿/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+#include "testBase.hpp"
+
+template<typename _Case>
+struct TestNoReverseSync : public TestBase<4, 1, 3, TestNoReverseSync<_Case>> {
+  public:
+    using Case = _Case;
+    using Base = TestBase<4, 1, 3, TestNoReverseSync<Case>>;
+
+    template<typename T>
+    static void test(std::array<T, Base::nIn> const& in, std::array<T, Base::nOut>& out) {
+
+      int const N = 100;
+      T* jobResults = new T[N];
+      int nCalls = 0;
+      int nRecorded = 0;
+
+      OPDI_PARALLEL()
+      {
+        int nThreads = omp_get_num_threads();
+        int start = ((N - 1) / nThreads + 1) * omp_get_thread_num();
+        int end = std::min(N, ((N - 1) / nThreads + 1) * (omp_get_thread_num() + 1));
+
+        for (int i = start; i < end; ++i) {
+          Base::job1(i, in, jobResults[i]);
+        }
+
+        #ifdef _OPENMP
+          void* tape = opdi::tool->getThreadLocalTape();
+          void* before = opdi::tool->allocPosition();
+          void* after = opdi::tool->allocPosition();
+          opdi::tool->getTapePosition(tape, before);
+        #endif
+
+        /* constructs that only protect passive data, nothing is recorded for them */
+        OPDI_NO_REVERSE_SYNC
+        {
+          OPDI_CRITICAL()
+          {
+            ++nCalls;
+          }
+          OPDI_END_CRITICAL
+
+          OPDI_CRITICAL_NAME(noReverseSync)
+          {
+            ++nCalls;
+          }
+          OPDI_END_CRITICAL
+
+          OPDI_BARRIER()
+        }
+        OPDI_END_NO_REVERSE_SYNC
+
+        #ifdef _OPENMP
+          opdi::tool->getTapePosition(tape, after);
+          if (opdi::tool->comparePosition(before, after) != 0) {
+            #pragma omp atomic
+            ++nRecorded;
+          }
+          opdi::tool->freePosition(before);
+          opdi::tool->freePosition(after);
+        #endif
+
+        OPDI_BARRIER()
+
+        start = ((N - 1) / nThreads + 1) * ((omp_get_thread_num() + 1) % nThreads);
+        end = std::min(N, ((N - 1) / nThreads + 1) * (((omp_get_thread_num() + 1) % nThreads) + 1));
+
+        for (int i = start; i < end; ++i) {
+          jobResults[i] = cos(exp(jobResults[i]));
+        }
+      }
+      OPDI_END_PARALLEL
+
+      for (int i = 0; i < N; ++i) {
+        out[0] += jobResults[i];
+      }
+
+      /* nonzero if handles were pushed inside the scope */
+      out[0] += nRecorded;
+
+      delete [] jobResults;
+    }
+};
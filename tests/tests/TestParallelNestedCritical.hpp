@@ -0,0 +1,85 @@
+﻿/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+#include "testBase.hpp"
+
+template<typename _Case>
+struct TestParallelNestedCritical : public TestBase<4, 1, 3, TestParallelNestedCritical<_Case>> {
+  public:
+    using Case = _Case;
+    using Base = TestBase<4, 1, 3, TestParallelNestedCritical<Case>>;
+
+    template<typename T>
+    static void test(std::array<T, Base::nIn> const& in, std::array<T, Base::nOut>& out) {
+
+      int const N = 100;
+      T* jobResults = new T[N];
+      T sum = 0.0;
+
+      OPDI_PARALLEL()
+      {
+        int outerNThreads = omp_get_num_threads();
+        int outerStart = ((N - 1) / outerNThreads + 1) * omp_get_thread_num();
+        int outerEnd = std::min(N, ((N - 1) / outerNThreads + 1) * (omp_get_thread_num() + 1));
+
+        /* the critical regions of different nested teams synchronize the outer implicit tasks */
+        OPDI_PARALLEL()
+        {
+          /* if possible, the thread of the outer implicit task does not participate */
+          int nWorkers = std::max(1, omp_get_num_threads() - 1);
+          int worker = omp_get_thread_num() - (omp_get_num_threads() - nWorkers);
+
+          if (worker >= 0) {
+            int innerStart = outerStart + (((outerEnd - outerStart) - 1) / nWorkers + 1) * worker;
+            int innerEnd = std::min(outerEnd, outerStart + (((outerEnd - outerStart) - 1) / nWorkers + 1)
+                                                                                       * (worker + 1));
+
+            for (int i = innerStart; i < innerEnd; ++i) {
+              Base::job1(i, in, jobResults[i]);
+
+              OPDI_CRITICAL()
+              {
+                sum += sin(jobResults[i]);
+              }
+              OPDI_END_CRITICAL
+            }
+          }
+        }
+        OPDI_END_PARALLEL
+      }
+      OPDI_END_PARALLEL
+
+      for (int i = 0; i < N; ++i) {
+        out[0] += jobResults[i];
+      }
+
+      out[0] += sum;
+
+      delete [] jobResults;
+    }
+};
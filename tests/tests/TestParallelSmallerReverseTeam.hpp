@@ -0,0 +1,89 @@
+﻿/*
+ * OpDiLib, an Open Multiprocessing Differentiation Library
+ *
+ * Copyright (C) 2020-2022 Chair for Scientific Computing (SciComp), TU Kaiserslautern
+ * Copyright (C) 2023-2026 Chair for Scientific Computing (SciComp), RPTU University Kaiserslautern-Landau
+ * Homepage: https://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (opdi@scicomp.uni-kl.de)
+ *
+ * Lead developer: Johannes Blühdorn (SciComp, RPTU University Kaiserslautern-Landau)
+ *
+ * This file is part of OpDiLib (https://scicomp.rptu.de/software/opdi).
+ *
+ * OpDiLib is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * OpDiLib is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License along with OpDiLib. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+
+#include "testBase.hpp"
+
+template<typename _Case>
+struct TestParallelSmallerReverseTeam : public TestBase<4, 1, 3, TestParallelSmallerReverseTeam<_Case>> {
+  public:
+    using Case = _Case;
+    using Base = TestBase<4, 1, 3, TestParallelSmallerReverseTeam<Case>>;
+
+    template<typename T>
+    static void test(std::array<T, Base::nIn> const& in, std::array<T, Base::nOut>& out) {
+
+      int const N = 100;
+      T* jobResults = new T[N];
+      T sum = 0.0;
+
+      #if defined(_OPENMP) && OPDI_ELASTIC_REVERSE_TEAM
+        static int const nRecordingThreads = omp_get_max_threads();
+        omp_set_num_threads(nRecordingThreads);
+      #endif
+
+      OPDI_PARALLEL()
+      {
+        int nThreads = omp_get_num_threads();
+        int start = ((N - 1) / nThreads + 1) * omp_get_thread_num();
+        int end = std::min(N, ((N - 1) / nThreads + 1) * (omp_get_thread_num() + 1));
+
+        for (int i = start; i < end; ++i) {
+          Base::job1(i, in, jobResults[i]);
+
+          OPDI_CRITICAL()
+          {
+            sum += sin(jobResults[i]);
+          }
+          OPDI_END_CRITICAL
+        }
+
+        OPDI_BARRIER()
+
+        start = ((N - 1) / nThreads + 1) * ((omp_get_thread_num() + 1) % nThreads);
+        end = std::min(N, ((N - 1) / nThreads + 1) * (((omp_get_thread_num() + 1) % nThreads) + 1));
+
+        for (int i = start; i < end; ++i) {
+          jobResults[i] = cos(exp(jobResults[i]));
+        }
+      }
+      OPDI_END_PARALLEL
+
+      for (int i = 0; i < N; ++i) {
+        out[0] += jobResults[i];
+      }
+
+      out[0] += sum;
+
+      delete [] jobResults;
+
+      #if defined(_OPENMP) && OPDI_ELASTIC_REVERSE_TEAM
+        /* the reverse pass runs the recorded threads on fewer threads */
+        omp_set_num_threads((nRecordingThreads + 1) / 2);
+      #endif
+    }
+};